@@ -10,6 +10,9 @@
 #include "BTreeIndex.h"
 #include "BTreeNode.h"
 #include <iostream>
+#include <cstring>
+#include <climits>
+#include <algorithm>
 #define TESTING 0
 
 using namespace std;
@@ -20,6 +23,9 @@ using namespace std;
 BTreeIndex::BTreeIndex()
 {
     rootPid = -1;
+    treeHeight = 0;
+    leafCount = 0;
+    compressLeaves = false;
 }
 
 //assumes indexfile is already open
@@ -70,6 +76,8 @@ RC BTreeIndex::open(const string& indexname, char mode)
 		//cout << indexname << " is empty - initializing rootPid to -1 and treeHeight to 0" << endl;
 		rootPid = -1;
 		treeHeight = 0;
+		leafCount = 0;
+		compressLeaves = false;
 
 		//write it immediately to pageId 0 of the file 
 		error = writeMetaData();
@@ -88,6 +96,18 @@ RC BTreeIndex::open(const string& indexname, char mode)
 		rootPid = *ptr;
 		ptr++;
 		treeHeight = *ptr;
+		ptr++;
+		leafCount = *ptr;
+		ptr++;
+		compressLeaves = (*ptr != 0);
+		ptr++;
+
+		//an older index has plain leaves, and about every page but the
+		//metadata page is a leaf
+		if (*ptr != METADATA_FORMAT || leafCount < 0 || leafCount >= pf.endPid()) {
+			leafCount = (treeHeight > 0) ? pf.endPid() - 1 : 0;
+			compressLeaves = false;
+		}
 	}	
 
 	//cout << "info loaded from file " << indexname << ": rootPid is "<< rootPid << " and treeHeight is " << treeHeight << endl; 
@@ -122,6 +142,7 @@ RC BTreeIndex::insert(int key, const RecordId& rid)
 	
 		//create an empty leafNode 
 		BTLeafNode* newLeaf = new BTLeafNode;
+		newLeaf->setCompressed(compressLeaves);
 
 		//insert into new node
 		error = newLeaf->insert(key, rid);
@@ -130,11 +151,13 @@ RC BTreeIndex::insert(int key, const RecordId& rid)
 			return error;
 		}
 
-		//set nextNodePtr 
+		//set nextNodePtr and prevNodePtr
 		newLeaf->setNextNodePtr(-1);
+		newLeaf->setPrevNodePtr(-1);
 
 		//set metadata of index to reflect changes
 		treeHeight = 1;  
+		leafCount = 1;
 		rootPid = pf.endPid();
 		//cout << "new root is getting assigned pageId: " << pf.endPid() << endl;
 	
@@ -204,7 +227,19 @@ RC BTreeIndex::insert(int key, const RecordId& rid)
 
 			//reset node pointers:
 			siblingLeaf->setNextNodePtr(siblingNodePtr);
+			siblingLeaf->setPrevNodePtr(cursor.pid);
 			targetLeaf->setNextNodePtr(siblingPid);
+			leafCount++;
+
+			//the old next leaf now follows the sibling
+			if (siblingNodePtr != -1) {
+				BTLeafNode nextLeaf;
+				if ((error = nextLeaf.read(siblingNodePtr, pf)) != 0)
+					return error;
+				nextLeaf.setPrevNodePtr(siblingPid);
+				if ((error = nextLeaf.write(siblingNodePtr, pf)) != 0)
+					return error;
+			}
 
 			//write to disk
 			error = siblingLeaf->write(siblingPid, pf);
@@ -240,6 +275,11 @@ RC BTreeIndex::insert(int key, const RecordId& rid)
 
 			//cout << ") will now be updated: "<< cursor.pid << " on left, "<< siblingKey << " as key pushed up, and " << siblingPid << " on right" << endl;
 			updateParent(cursor.pid, siblingKey, siblingPid);
+
+			//record the new leaf count on disk
+			error = writeMetaData();
+			if (error != 0)
+				return error;
 		}
 	}
     return 0;
@@ -299,7 +339,7 @@ RC BTreeIndex::updateParent(PageId left, int key, PageId right) {
 		//cout << "right is " << right << endl;
 
 		//insert value in parent - if insert works, we're done
-		error = parent->insert(key, right);
+		error = parent->insert(key, right, left);
 		if (error !=0) {
 			//cout << "parent with pid " << parentPid << " is full on update after insert in BTreeIndex - splitting" << endl;
 
@@ -307,7 +347,7 @@ RC BTreeIndex::updateParent(PageId left, int key, PageId right) {
 			int midKey;
 			BTNonLeafNode * sibling = new BTNonLeafNode;
 			//cout << "calling insertAndSplit(" << key << ", " << right << ", " << "sibling" << ", " << midKey << ")" << endl;
-			error = parent->insertAndSplit(key, right, *sibling, midKey);
+			error = parent->insertAndSplit(key, right, *sibling, midKey, left);
 			if (error != 0) {
 				//cerr << "error in insertAndSplit in updateParents of BTreeIndex" << endl;
 				delete parent;
@@ -501,8 +541,10 @@ RC BTreeIndex::locate(int searchKey, IndexCursor& cursor) {
             if ((rc = nonLeafNode.read(pid, pf)) != 0)
                 return rc;
             
-            // get pointer to child node
-            if ((rc = nonLeafNode.locateChildPtr(searchKey, pid)) != 0)
+            // get pointer to child node. copies of searchKey can be on
+            // both sides of an equal key, so the descent goes left of it
+            int upperKey;
+            if ((rc = nonLeafNode.locateFirstChildPtr(searchKey, pid, upperKey)) != 0)
                 return rc;
             
             // update current height
@@ -595,6 +637,397 @@ RC BTreeIndex::readForward(IndexCursor& cursor, int& key, RecordId& rid) {
     return 0;
 }
 
+/*
+ * Find the last leaf-node index entry whose key value is smaller than or
+ * equal to searchKey, and output its location in IndexCursor.
+ * @param searchKey[IN] the key to find
+ * @param cursor[OUT] the cursor pointing to the last index entry
+ *                    with a key value <= searchKey
+ * @return error code. 0 if no error (RC_END_OF_TREE if every key in the
+ * index is larger than searchKey)
+ */
+RC BTreeIndex::locateBackward(int searchKey, IndexCursor& cursor) {
+    RC rc;
+    PageId pid = rootPid;
+
+    if (treeHeight == 0)
+        return RC_NO_SUCH_RECORD;
+
+    // the child that covers searchKey holds every key <= searchKey that
+    // is larger than the separator in front of it
+    BTNonLeafNode nonLeafNode;
+    for (int height = 1; height < treeHeight; height++) {
+        if ((rc = nonLeafNode.read(pid, pf)) != 0)
+            return rc;
+        if ((rc = nonLeafNode.locateChildPtr(searchKey, pid)) != 0)
+            return rc;
+    }
+
+    // the entry in front of the first key > searchKey
+    BTLeafNode leafNode;
+    if ((rc = leafNode.read(pid, pf)) != 0)
+        return rc;
+    int eid;
+    if (searchKey == INT_MAX || leafNode.locate(searchKey + 1, eid) != 0)
+        eid = leafNode.getKeyCount();
+
+    // every key in the leaf is larger: the entry is the last one of the
+    // previous leaf
+    if (eid == 0) {
+        pid = leafNode.getPrevNodePtr();
+        if (pid == -1)
+            return RC_END_OF_TREE;
+        if ((rc = leafNode.read(pid, pf)) != 0)
+            return rc;
+        eid = leafNode.getKeyCount();
+    }
+
+    cursor.pid = pid;
+    cursor.eid = eid - 1;
+    return 0;
+}
+
+/*
+ * Read the (key, rid) pair at the location specified by the index cursor,
+ * and move the cursor backward to the previous entry.
+ * @param cursor[IN/OUT] the cursor pointing to an leaf-node index entry in the b+tree
+ * @param key[OUT] the key stored at the index cursor location.
+ * @param rid[OUT] the RecordId stored at the index cursor location.
+ * @return error code. 0 if no error (RC_END_OF_TREE after the first entry of the tree)
+ */
+RC BTreeIndex::readBackward(IndexCursor& cursor, int& key, RecordId& rid) {
+    RC rc;
+    BTLeafNode node;
+    if ((rc = node.read(cursor.pid, pf)) != 0)
+        return rc;
+
+    // eid -1 stands for the last entry of the leaf: the cursor moves to a
+    // previous leaf without reading it
+    if (cursor.eid == -1)
+        cursor.eid = node.getKeyCount() - 1;
+    if ((rc = node.readEntry(cursor.eid, key, rid)) != 0)
+        return rc;
+
+    if (cursor.eid == 0) {
+        cursor.eid = -1;
+        cursor.pid = (int) node.getPrevNodePtr();
+
+        // there is no previous node: this was the first entry of the tree
+        if (cursor.pid == -1)
+            return RC_END_OF_TREE;
+    }
+    else {
+        cursor.eid--;
+    }
+    return 0;
+}
+
+/*
+ * Find the leaf-node index entries of a batch of keys in ascending order.
+ * The non-leaf nodes on the path to the last leaf stay in memory, and
+ * every key climbs up this path only until it reaches a node that covers it.
+ * @param keys[IN] the keys to find, in ascending order
+ * @param cursors[OUT] cursors[i] points to the first index entry with a
+ *                     key >= keys[i] (pid is -1 if there is no such entry)
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::locateBatch(const vector<int>& keys, vector<IndexCursor>& cursors)
+{
+    RC rc;
+    int levels = (treeHeight > 1) ? treeHeight - 1 : 0;  // # non-leaf levels
+
+    // nodes[l] is the non-leaf node at level l (the root is at level 0) on
+    // the path to the leaf in memory; the keys under it are <= fences[l]
+    // (INT_MAX if the node has no upper bound). depth nodes are valid.
+    vector<BTNonLeafNode> nodes(levels);
+    vector<int> fences(levels);
+    int depth = 0;
+
+    BTLeafNode leaf;
+    PageId leafPid = -1;
+    int lastKey = 0;     // the largest key in leaf
+    int eid, upperKey;
+    RecordId rid;
+
+    cursors.resize(keys.size());
+    for (unsigned i = 0; i < keys.size(); i++) {
+        cursors[i].pid = -1;
+        cursors[i].eid = 0;
+        if (treeHeight == 0)
+            continue;
+
+        // a key past the last key of the leaf in memory is in a later leaf
+        if (leafPid == -1 || keys[i] > lastKey) {
+            // climb up to the lowest node on the path that covers the key.
+            // the keys are sorted, so only the upper bounds need checking
+            while (depth > 1 && keys[i] > fences[depth - 1])
+                depth--;
+
+            if (depth == 0 && levels > 0) {
+                if ((rc = nodes[0].read(rootPid, pf)) != 0)
+                    return rc;
+                fences[0] = INT_MAX;
+                depth = 1;
+            }
+
+            // descend from there to the leaf
+            PageId pid = rootPid;
+            while (depth < levels) {
+                nodes[depth - 1].locateFirstChildPtr(keys[i], pid, upperKey);
+                if ((rc = nodes[depth].read(pid, pf)) != 0)
+                    return rc;
+                fences[depth] = (upperKey < fences[depth - 1]) ? upperKey : fences[depth - 1];
+                depth++;
+            }
+            if (levels > 0)
+                nodes[levels - 1].locateFirstChildPtr(keys[i], pid, upperKey);
+
+            if (pid != leafPid) {
+                if ((rc = leaf.read(pid, pf)) != 0)
+                    return rc;
+                leafPid = pid;
+                if (leaf.getKeyCount() == 0 || leaf.readEntry(leaf.getKeyCount() - 1, lastKey, rid) != 0)
+                    lastKey = INT_MIN;
+            }
+        }
+
+        // the first entry >= key is in the leaf, or else it is the
+        // first entry of the next leaf
+        if (leaf.locate(keys[i], eid) == 0) {
+            cursors[i].pid = leafPid;
+            cursors[i].eid = eid;
+        }
+        else
+            cursors[i].pid = leaf.getNextNodePtr();
+    }
+
+    return 0;
+}
+
+/*
+ * Build the index bottom-up from its entries sorted by key.
+ * The tree must be empty.
+ * @param entries[IN] the (key, rid) pairs sorted by key
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::bulkLoad(const vector<pair<int, RecordId> >& entries)
+{
+    RC rc;
+
+    if ((rc = startBulkLoad()) != 0)
+        return rc;
+    for (unsigned i = 0; i < entries.size(); i++) {
+        if ((rc = addBulkEntry(entries[i].first, entries[i].second)) != 0)
+            return rc;
+    }
+    return finishBulkLoad();
+}
+
+/*
+ * Start building the index bottom-up from entries added one at a time.
+ * The tree must be empty.
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::startBulkLoad()
+{
+    if (treeHeight != 0)
+        return RC_INVALID_FILE_FORMAT;
+
+    // the leaves go to consecutive pages, so the sibling pointers are known
+    bulkFirstLeaf = pf.endPid();
+    if (bulkFirstLeaf == 0)
+        bulkFirstLeaf = 1;  // page 0 holds the metadata
+    bulkLeaf.clear();
+    bulkLeaves.clear();
+    return 0;
+}
+
+/*
+ * Add the next entry of a bulk load. A leaf ends in front of the run of
+ * keys that crosses its end, unless the run started the leaf.
+ * @param key[IN] the key, not smaller than the key of the last entry
+ * @param rid[IN] the RecordId of the entry
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::addBulkEntry(int key, const RecordId& rid)
+{
+    RC rc;
+    const int capacity = NUMNODEPTRS - 1;  // # entries in a full plain leaf
+
+    // the entry goes to the leaf being filled if it fits. a compressed
+    // leaf takes entries as long as they fit packed
+    bool fits;
+    if (bulkLeaf.empty())
+        fits = true;
+    else if (compressLeaves)
+        fits = BTLeafNode::fitsPacked(bulkLeaf.size() + 1,
+            (unsigned)key - (unsigned)bulkLeaf[0].first,
+            (unsigned)max(bulkPids[1], rid.pid) - (unsigned)min(bulkPids[0], rid.pid),
+            (unsigned)max(bulkSids[1], rid.sid) - (unsigned)min(bulkSids[0], rid.sid));
+    else
+        fits = ((int)bulkLeaf.size() < capacity);
+    if (fits) {
+        if (bulkLeaf.empty()) {
+            bulkPids[0] = bulkPids[1] = rid.pid;
+            bulkSids[0] = bulkSids[1] = rid.sid;
+        }
+        bulkPids[0] = min(bulkPids[0], rid.pid); bulkPids[1] = max(bulkPids[1], rid.pid);
+        bulkSids[0] = min(bulkSids[0], rid.sid); bulkSids[1] = max(bulkSids[1], rid.sid);
+        bulkLeaf.push_back(make_pair(key, rid));
+        return 0;
+    }
+
+    // the run of the key moves to the next leaf with the entry
+    int cut = bulkLeaf.size();
+    while (cut > 0 && bulkLeaf[cut - 1].first == key)
+        cut--;
+    if ((rc = writeBulkLeaf(cut > 0 ? cut : bulkLeaf.size(), false)) != 0)
+        return rc;
+    return addBulkEntry(key, rid);
+}
+
+/*
+ * Write the last leaf of a bulk load, and then every level of non-leaf
+ * nodes above the leaves.
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::finishBulkLoad()
+{
+    RC rc;
+
+    if (!bulkLeaf.empty() && (rc = writeBulkLeaf(bulkLeaf.size(), true)) != 0)
+        return rc;
+    if (bulkLeaves.empty())
+        return 0;
+    treeHeight = 1;
+    leafCount = bulkLeaves.size();
+
+    // build the non-leaf levels until a single root is left. the children
+    // are spread evenly over the nodes, so every node has at least two
+    vector<pair<int, PageId> > level;  // the first key and pid of every node
+    level.swap(bulkLeaves);
+    while (level.size() > 1) {
+        int fanout = BTNonLeafNode::KEYS_PER_NODE + 1;
+        int nodes = (level.size() + fanout - 1) / fanout;
+        vector<pair<int, PageId> > parents;
+        for (int i = 0; i < nodes; i++) {
+            int first = (long)i * level.size() / nodes;
+            int end = (long)(i + 1) * level.size() / nodes;
+            BTNonLeafNode node;
+            node.initializeRoot(level[first].second, level[first + 1].first, level[first + 1].second);
+            for (int j = first + 2; j < end; j++) {
+                if ((rc = node.append(level[j].first, level[j].second)) != 0)
+                    return rc;
+            }
+            PageId pid = pf.endPid();
+            if ((rc = node.write(pid, pf)) != 0)
+                return rc;
+            parents.push_back(make_pair(level[first].first, pid));
+        }
+        level.swap(parents);
+        treeHeight++;
+    }
+    rootPid = level[0].second;
+
+    return writeMetaData();
+}
+
+/*
+ * Write the first count entries of the leaf being filled by a bulk load
+ * as the next leaf, and keep the rest of them for the leaf after it.
+ * @param count[IN] the # entries of the leaf
+ * @param last[IN] true if it is the last leaf
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::writeBulkLeaf(int count, bool last)
+{
+    RC rc;
+    BTLeafNode leaf;
+    PageId pid = bulkFirstLeaf + bulkLeaves.size();
+
+    leaf.setCompressed(compressLeaves);
+    for (int i = 0; i < count; i++) {
+        if ((rc = leaf.insert(bulkLeaf[i].first, bulkLeaf[i].second)) != 0)
+            return rc;
+    }
+    leaf.setNextNodePtr(last ? -1 : pid + 1);
+    leaf.setPrevNodePtr(bulkLeaves.empty() ? -1 : pid - 1);
+    if ((rc = leaf.write(pid, pf)) != 0)
+        return rc;
+    bulkLeaves.push_back(make_pair(bulkLeaf[0].first, pid));
+
+    bulkLeaf.erase(bulkLeaf.begin(), bulkLeaf.begin() + count);
+    for (unsigned i = 0; i < bulkLeaf.size(); i++) {
+        const RecordId& rid = bulkLeaf[i].second;
+        if (i == 0) {
+            bulkPids[0] = bulkPids[1] = rid.pid;
+            bulkSids[0] = bulkSids[1] = rid.sid;
+        }
+        bulkPids[0] = min(bulkPids[0], rid.pid); bulkPids[1] = max(bulkPids[1], rid.pid);
+        bulkSids[0] = min(bulkSids[0], rid.sid); bulkSids[1] = max(bulkSids[1], rid.sid);
+    }
+    return 0;
+}
+
+/*
+ * Find keys that split the key range [low, high] into parts under
+ * different subtrees: the separator keys of the root in (low, high], and
+ * those of the next levels down while there are fewer than count.
+ * @param low[IN] the smallest key of the range
+ * @param high[IN] the largest key of the range
+ * @param count[IN] the # separator keys wanted
+ * @param keys[OUT] the separator keys in ascending order
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::getSeparators(int low, int high, int count, vector<int>& keys)
+{
+    RC rc;
+    BTNonLeafNode node;
+    PageId pid;
+    int key;
+
+    keys.clear();
+
+    // the nodes of the current level whose keys may fall in the range
+    vector<PageId> level(1, rootPid);
+    for (int height = 1; height < treeHeight && (int)keys.size() < count; height++) {
+        vector<PageId> children;
+        for (unsigned i = 0; i < level.size(); i++) {
+            if ((rc = node.read(level[i], pf)) != 0)
+                return rc;
+
+            // the child in front of a key holds the keys in [lastKey, key)
+            int lastKey = INT_MIN;
+            for (int eid = 0; eid <= node.getKeyCount(); eid++) {
+                node.readEntry(eid, pid, key);
+                if (eid < node.getKeyCount() && key > low && key <= high)
+                    keys.push_back(key);
+                if (lastKey <= high && key > low && height + 1 < treeHeight)
+                    children.push_back(pid);
+                lastKey = key;
+            }
+        }
+        level.swap(children);
+    }
+
+    // the keys of a level are in order, but not the keys of different levels
+    sort(keys.begin(), keys.end());
+    return 0;
+}
+
+/*
+ * Choose whether the leaves of the tree are compressed.
+ * @param compress[IN] true for compressed leaves
+ * @return error code. 0 if no error
+ */
+RC BTreeIndex::setCompressLeaves(bool compress)
+{
+    if (treeHeight != 0)
+        return RC_INVALID_FILE_FORMAT;
+    compressLeaves = compress;
+    return writeMetaData();
+}
+
 //--------------------------------helper functions------------------------------
 
 // void BTreeIndex::printTree() {
@@ -617,9 +1050,16 @@ RC BTreeIndex::writeMetaData() {
     char buf[PageFile::PAGE_SIZE];
     int *ptr = (int*)buf;
 
+    memset(buf, 0, PageFile::PAGE_SIZE);
     *ptr = rootPid;
     ptr++;
 	*ptr = treeHeight;
+    ptr++;
+	*ptr = leafCount;
+    ptr++;
+	*ptr = compressLeaves ? 1 : 0;
+    ptr++;
+	*ptr = METADATA_FORMAT;
     error=pf.write(0, buf);
     if (error!=0)
 		return error;
@@ -14,6 +14,7 @@
 #include "PageFile.h"
 #include "RecordFile.h"
 #include <stack>
+#include <vector>
              
 /**
  * The data structure to point to a particular entry at a b+tree leaf node.
@@ -91,20 +92,148 @@ class BTreeIndex {
    */
   RC readForward(IndexCursor& cursor, int& key, RecordId& rid);
 
+  /**
+   * Find the last leaf-node index entry whose key is smaller than or
+   * equal to searchKey, for a scan in descending key order with
+   * readBackward().
+   * @param searchKey[IN] the key to find
+   * @param cursor[OUT] the cursor pointing to the last index entry
+   * with a key <= searchKey
+   * @return error code. 0 if no error (RC_END_OF_TREE if there is no
+   * such entry)
+   */
+  RC locateBackward(int searchKey, IndexCursor& cursor);
+
+  /**
+   * Read the (key, rid) pair at the location specified by the index cursor,
+   * and move the cursor backward to the previous entry.
+   * @param cursor[IN/OUT] the cursor pointing to an leaf-node index entry in the b+tree
+   * @param key[OUT] the key stored at the index cursor location
+   * @param rid[OUT] the RecordId stored at the index cursor location
+   * @return error code. 0 if no error (RC_END_OF_TREE if the entry was
+   * the first one in the index)
+   */
+  RC readBackward(IndexCursor& cursor, int& key, RecordId& rid);
+
+  /**
+   * Find the leaf-node index entries of a batch of keys, as locate()
+   * does for one key. The keys must be sorted in ascending order.
+   * The path from the root to the leaf of the previous key is kept in
+   * memory, and the search for the next key climbs up this path only
+   * as far as needed (finger search), so every node of the tree is
+   * read at most once for the whole batch.
+   * @param keys[IN] the keys to find, in ascending order
+   * @param cursors[OUT] cursors[i] points to the first index entry with
+   * a key >= keys[i] (pid is -1 if there is no such entry)
+   * @return error code. 0 if no error
+   */
+  RC locateBatch(const std::vector<int>& keys, std::vector<IndexCursor>& cursors);
+
+  /**
+   * Build the index bottom-up from all its entries at once: the leaves
+   * are filled left to right, and then every level of non-leaf nodes
+   * above them. The tree must be empty.
+   * A run of entries with the same key is not split between leaves
+   * unless it does not fit in one.
+   * @param entries[IN] the (key, rid) pairs sorted by key
+   * @return error code. 0 if no error
+   */
+  RC bulkLoad(const std::vector<std::pair<int, RecordId> >& entries);
+
+  /**
+   * Build the index bottom-up as bulkLoad() does, from entries that are
+   * passed one at a time, so that they do not all have to be in memory.
+   * startBulkLoad() is called first, then addBulkEntry() for every
+   * entry in key order, and finishBulkLoad() writes the levels above
+   * the leaves. The tree must be empty.
+   * @return error code. 0 if no error
+   */
+  RC startBulkLoad();
+
+  /**
+   * Add the next entry of a bulk load (see startBulkLoad()). The leaves
+   * are written as soon as they are full.
+   * @param key[IN] the key, not smaller than the key of the last entry
+   * @param rid[IN] the RecordId of the entry
+   * @return error code. 0 if no error
+   */
+  RC addBulkEntry(int key, const RecordId& rid);
+
+  /**
+   * Write the last leaf of a bulk load and the non-leaf levels above the
+   * leaves (see startBulkLoad()).
+   * @return error code. 0 if no error
+   */
+  RC finishBulkLoad();
+
+  /**
+   * Find keys that split a key range into parts under different subtrees,
+   * for scanning the parts in parallel. The separator keys of the root
+   * in (low, high] are returned, and those of the next levels down as
+   * long as there are fewer than count of them.
+   * @param low[IN] the smallest key of the range
+   * @param high[IN] the largest key of the range
+   * @param count[IN] the # separator keys wanted
+   * @param keys[OUT] the separator keys in ascending order (empty if the
+   * tree has a single level)
+   * @return error code. 0 if no error
+   */
+  RC getSeparators(int low, int high, int count, std::vector<int>& keys);
+
+  /**
+   * Choose whether the leaves of the tree are compressed: their keys are
+   * delta-encoded and their RecordIds bit-packed, so that a leaf holds
+   * up to BTLeafNode::MAX_PACKED_KEYS entries instead of NUMNODEPTRS-1.
+   * The choice is kept in the index file. It can be made only while the
+   * tree is empty; the leaves of an index file that was written before
+   * compressed leaves existed are plain.
+   * @param compress[IN] true for compressed leaves
+   * @return error code. 0 if no error
+   */
+  RC setCompressLeaves(bool compress);
+
+  /**
+   * @return true if the leaves of the tree are compressed
+   */
+  bool getCompressLeaves() const { return compressLeaves; }
+
+  /**
+   * @return the height of the tree (0 if the tree is empty)
+   */
+  int getTreeHeight() const { return treeHeight; }
+
+  /**
+   * @return the number of leaf nodes in the tree
+   */
+  int getLeafCount() const { return leafCount; }
+
 	//helper function for debugging
 	void printRoot();
 // 	void printTree();
   
  private:
+  /// the word behind the metadata of an index that keeps its leaf count
+  /// and leaf format. the metadata page of an older index has only the
+  /// root and the height, and whatever the page buffer held behind them.
+  static const int METADATA_FORMAT = 0x42546931;
+
   PageFile pf;         /// the PageFile used to store the actual b+tree in disk
 
   PageId   rootPid;    /// the PageId of the root node
   int      treeHeight; /// the height of the tree
+  int      leafCount;  /// the number of leaf nodes (used for cost estimation)
+  bool     compressLeaves; /// true if new leaves are compressed
 
   std::stack<PageId> parents;
 
-  /// Note that the content of the above two variables will be gone when
-  /// this class is destructed. Make sure to store the values of the two 
+  /// the state of a bulk load (see startBulkLoad())
+  std::vector<std::pair<int, RecordId> > bulkLeaf;  /// the entries of the leaf being filled
+  std::vector<std::pair<int, PageId> > bulkLeaves;  /// the first key and pid of every leaf written
+  PageId   bulkFirstLeaf;  /// the pid of the first leaf
+  int      bulkPids[2], bulkSids[2];  /// the smallest and largest pid and sid in bulkLeaf
+
+  /// Note that the content of the above variables will be gone when
+  /// this class is destructed. Make sure to store the values of these
   /// variables in disk, so that they can be reconstructed when the index
   /// is opened again later.
 
@@ -120,6 +249,9 @@ class BTreeIndex {
 	//locating position for insert
 	RC locateForInsert(int searchKey, IndexCursor& cursor);
 
+	//write the first count entries of bulkLeaf as the next leaf of a bulk load
+	RC writeBulkLeaf(int count, bool last);
+
 };
 
 #endif /* BTREEINDEX_H */
@@ -1,12 +1,66 @@
 #include "BTreeNode.h"
 #include <iostream>
 #include <cstring>
+#include <climits>
 using namespace std;
 
 
 //constructor
 BTLeafNode::BTLeafNode() {
+	compressed = false;
+	packed = false;
 	setKeyCount(0);
+	findRidRange();
+}
+
+//the # bits that hold every number from 0 to range
+static int bitWidth(unsigned range)
+{
+	int bits = 0;
+	while (range != 0) {
+		bits++;
+		range >>= 1;
+	}
+	return bits;
+}
+
+//read the bits of a field of the packed entries, at bit offset pos.
+//a field has at most 32 bits, so it is in the 8 bytes read at once
+static unsigned getBits(const char* data, unsigned pos, int bits)
+{
+	unsigned long long word;
+	memcpy(&word, data + (pos >> 3), sizeof(word));
+	return (unsigned)((word >> (pos & 7)) & ((1ULL << bits) - 1));
+}
+
+//write a field of the packed entries (the bits after it must be zero).
+//the value is cut to the width of the field, so it cannot spill into the
+//next one
+static void putBits(char* data, unsigned pos, int bits, unsigned value)
+{
+	unsigned long long word;
+	memcpy(&word, data + (pos >> 3), sizeof(word));
+	word |= ((unsigned long long)value & ((1ULL << bits) - 1)) << (pos & 7);
+	memcpy(data + (pos >> 3), &word, sizeof(word));
+}
+
+void BTLeafNode::setCompressed(bool compressed)
+{
+	this->compressed = compressed;
+	if (!packed)
+		findRidRange();
+}
+
+bool BTLeafNode::isCompressed()
+{
+	return compressed;
+}
+
+bool BTLeafNode::fitsPacked(int count, unsigned keyRange, unsigned pidRange, unsigned sidRange)
+{
+	int bits = bitWidth(keyRange) + bitWidth(pidRange) + bitWidth(sidRange);
+	return count <= MAX_PACKED_KEYS &&
+		count * bits <= (PageFile::PAGE_SIZE - PACKED_HEADER) * 8;
 }
 
 /*
@@ -26,6 +80,15 @@ RC BTLeafNode::read(PageId pid, const PageFile& pf)
 		exit(RC_FILE_READ_FAILED);
 	}
 
+	//a compressed leaf stays packed until it is changed; the prevNodePtr
+	//of a plain leaf moves from the end of the page to the end of buffer
+	packed = compressed = (*(int*)buffer & PACKED_FLAG) != 0;
+	if (!packed) {
+		PageId* prev = (PageId*)(buffer + PageFile::PAGE_SIZE - sizeof(PageId));
+		setPrevNodePtr(*prev);
+		*prev = 0;
+	}
+
 	return 0; }
     
 /*
@@ -38,7 +101,20 @@ RC BTLeafNode::read(PageId pid, const PageFile& pf)
 RC BTLeafNode::write(PageId pid, PageFile& pf)
 { 
 	RC error;
-	error = pf.write(pid, buffer);
+	char page[PageFile::PAGE_SIZE + sizeof(long long)];
+
+	if (packed)
+		error = pf.write(pid, buffer);
+	else if (compressed) {
+		if ((error = pack(page)) != 0)
+			return error;
+		error = pf.write(pid, page);
+	}
+	else {
+		memcpy(page, buffer, PageFile::PAGE_SIZE);
+		*(PageId*)(page + PageFile::PAGE_SIZE - sizeof(PageId)) = getPrevNodePtr();
+		error = pf.write(pid, page);
+	}
 	if (error !=0) {
 		//cerr << "Error on writing BTLeafNode to PageFile" << endl; 
 		return(RC_FILE_WRITE_FAILED);
@@ -52,11 +128,11 @@ RC BTLeafNode::write(PageId pid, PageFile& pf)
  * @return the number of keys in the node
  */
 int BTLeafNode::getKeyCount()
-{ return *(int*)buffer; }
+{ return *(int*)buffer & ~PACKED_FLAG; }
 
 //set the keyCount variable
 void BTLeafNode::setKeyCount(int value) {
-	*(int*)buffer = value;
+	*(int*)buffer = packed ? (value | PACKED_FLAG) : value;
 }
 
 
@@ -70,9 +146,19 @@ void BTLeafNode::setKeyCount(int value) {
 //returns RC_NODE_FULL if node is full
 RC BTLeafNode::insert(int key, const RecordId& rid)
 { 
+	//a compressed leaf is changed in the plain layout
+	if (packed)
+		unpack();
+
 	//check if node is full
 	int numKeys = getKeyCount();
 
+	if (compressed) {
+		if (numKeys == MAX_PACKED_KEYS || !fitsWith(key, rid))
+			return RC_NODE_FULL;
+		return insertInBuffer(key, rid);
+	}
+
 	if (numKeys == NUMNODEPTRS-1){
 		//cerr << "Node is full - cannot insert" << endl;
 		return RC_NODE_FULL;
@@ -104,29 +190,30 @@ RC BTLeafNode::insertAndSplit(int key, const RecordId& rid,
         int key;
     };
 
+	if (packed)
+		unpack();
+
 	//cout << "node's buffer currently reads: ";
 	//printNode();
 	//cout << endl;
 
-	//find where new key should go
-	int temp;
-	char* placement = bufPlacement(buffer, key, temp);
-	//cout << "insert into buffer should be at: " << (void*) placement << endl;
-
 	//insert key in buffer 
 	insertInBuffer(key, rid);
 
 	//find split point - ptr will point to first location to be copied to sibling
+	//(a full plain leaf has NUMNODEPTRS keys now; a compressed one may have fewer)
 	struct leafNode* ptr = (struct leafNode*)(buffer+sizeof(int));
-	int numOnLeft = (NUMNODEPTRS+1)/2;
+	int numKeys = getKeyCount();
+	int numOnLeft = (numKeys+1)/2;
 	//cout << "number of keys staying on left is " << numOnLeft << endl;
 	int i;
 	for (i=0; i < numOnLeft; i++) {
 		ptr++;
 	}
 
-	//calculate how much to copy to sibling
-	int filled = (sizeof(RecordId) + sizeof(int)) * (getKeyCount()+1) + sizeof(PageId) + sizeof(int); 
+	//calculate how much to copy to sibling (the keyCount already includes
+	//the new key, so this stays clear of the prevNodePtr at the end of the page)
+	int filled = (sizeof(RecordId) + sizeof(int)) * getKeyCount() + sizeof(PageId) + sizeof(int); 
 	int amtToCopy = filled - ((char*)ptr-(char*)buffer);
 
 	//copy all to sibling (including nextNodePtr)
@@ -135,8 +222,12 @@ RC BTLeafNode::insertAndSplit(int key, const RecordId& rid,
 	//change keyCount of leafNode
 	setKeyCount(numOnLeft);
 	
-	//give sibling its keyCount - are NUMNODEPTRS keys in total now, after insertion
-	sibling.setKeyCount(NUMNODEPTRS - numOnLeft);
+	//give sibling its keyCount and the format of this node
+	sibling.compressed = compressed;
+	sibling.packed = false;
+	sibling.setKeyCount(numKeys - numOnLeft);
+	findRidRange();
+	sibling.findRidRange();
 
 	//remove rest of buffer
 	memset(ptr, '\0', amtToCopy);
@@ -168,6 +259,22 @@ RC BTLeafNode::insertAndSplit(int key, const RecordId& rid,
 RC BTLeafNode::locate(int searchKey, int& eid)
 { 
 	int temp;
+
+	//the keys of a packed leaf are binary searched in place
+	if (packed) {
+		int low = 0, high = getKeyCount();
+		while (low < high) {
+			int mid = (low + high) / 2;
+			if (packedKey(mid) < searchKey)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		if (low == getKeyCount())
+			return RC_NO_SUCH_RECORD;
+		eid = low;
+		return 0;
+	}
 	
 	//find location where searchKey should go, using bufPlacement 
 	bufPlacement(buffer, searchKey, temp);
@@ -198,6 +305,11 @@ RC BTLeafNode::readEntry(int eid, int& key, RecordId& rid)
 		return RC_NO_SUCH_RECORD;
 	}
 
+	if (packed) {
+		packedEntry(eid, key, rid);
+		return 0;
+	}
+
 	//go to location in buffer specified by eid
 	char* entry = goToEid(buffer, eid);
 	
@@ -219,6 +331,9 @@ RC BTLeafNode::readEntry(int eid, int& key, RecordId& rid)
  */
 PageId BTLeafNode::getNextNodePtr()
 { 
+	if (packed)
+		return ((PageId*)buffer)[1];
+
 	//go to final RecordId/Key pair in node
 	char* ptr = goToEid(buffer, getKeyCount()-1);
 
@@ -236,6 +351,11 @@ PageId BTLeafNode::getNextNodePtr()
  */
 RC BTLeafNode::setNextNodePtr(PageId pid)
 { 
+	if (packed) {
+		((PageId*)buffer)[1] = pid;
+		return 0;
+	}
+
 	//go to final RecordId/Key pair in node
 	char* ptr = goToEid(buffer, getKeyCount()-1);
 	ptr+= (sizeof(RecordId)+sizeof(int));
@@ -249,6 +369,34 @@ RC BTLeafNode::setNextNodePtr(PageId pid)
 	return 0; 
 }
 
+/*
+ * Return the pid of the previous sibling node.
+ * @return the PageId of the previous sibling node (-1 for the first leaf)
+ */
+//NOTE: the prevNodePtr is kept in the last bytes of buffer (and of the page
+//on disk), which the entries and the nextNodePtr never reach (even during
+//insertAndSplit)
+PageId BTLeafNode::getPrevNodePtr()
+{
+	if (packed)
+		return ((PageId*)buffer)[2];
+	return *(PageId*)(buffer + BUFFER_SIZE - sizeof(PageId));
+}
+
+/*
+ * Set the pid of the previous sibling node.
+ * @param pid[IN] the PageId of the previous sibling node 
+ * @return 0 if successful. Return an error code if there is an error.
+ */
+RC BTLeafNode::setPrevNodePtr(PageId pid)
+{
+	if (packed)
+		((PageId*)buffer)[2] = pid;
+	else
+		*(PageId*)(buffer + BUFFER_SIZE - sizeof(PageId)) = pid;
+	return 0;
+}
+
 /*------------*/
 //helper functions:
 
@@ -259,6 +407,9 @@ void BTLeafNode::printNode() {
 		int key;
 	};
 
+	if (packed)
+		unpack();
+
 	struct leafNode* ptr = (struct leafNode*)(buffer + sizeof(int));
 	//cout << "in printNode, buffer is at: " << (void*)buffer << endl;
 	//cout << "in printNode, ptr starts at: " << (void*)ptr << endl;
@@ -296,15 +447,20 @@ char* BTLeafNode::bufPlacement (const char* buf, int k, int& eid) {
 	//cout << "in bufPlacement, buffer is at: " << (void*)buf << endl;
 	//cout << "in bufPlacement, placement starts at: " <<	(void*)ptr << endl;
 	
-	//after exiting loop, either we have found the first key larger than or equal to 
+	//after the binary search, either we have found the first key larger than or equal to 
 	//the sought value and we should insert key before it
 	//or no such key exists, in which case ptr stops at the end of all current keys 
 	int count = 0;
 	int numKeys = getKeyCount();
-	while ((count < numKeys) && (ptr->key < k)){
-		ptr++;
-		count++;
+	int high = numKeys;
+	while (count < high) {
+		int mid = (count + high) / 2;
+		if (ptr[mid].key < k)
+			count = mid + 1;
+		else
+			high = mid;
 	}
+	ptr += count;
 
 	if (count == numKeys) {
 		eid = -1;
@@ -347,7 +503,7 @@ RC BTLeafNode::insertInBuffer(int key, const RecordId& rid) {
 	//cout <<"amount of buffer filled: " << filled << endl;
 
 	//copy rest of buffer into a temp buffer
-	char temp[PageFile::PAGE_SIZE];
+	char temp[BUFFER_SIZE];
 	int amtToCopy = (filled - prePlacement);
 	//cout << "amount to copy is: " << amtToCopy << endl;
 	memcpy((void*)temp, (const void*)placement, amtToCopy);
@@ -365,6 +521,11 @@ RC BTLeafNode::insertInBuffer(int key, const RecordId& rid) {
 
 	//increment the keyCount variable
 	setKeyCount(getKeyCount()+1);
+
+	if (rid.pid < minPid) minPid = rid.pid;
+	if (rid.pid > maxPid) maxPid = rid.pid;
+	if (rid.sid < minSid) minSid = rid.sid;
+	if (rid.sid > maxSid) maxSid = rid.sid;
 	
 	//cout << "after insert, buffer is now: ";
 	//printNode();
@@ -373,6 +534,168 @@ RC BTLeafNode::insertInBuffer(int key, const RecordId& rid) {
 	return 0; 
 }
 
+//read the key of an entry of the packed page
+int BTLeafNode::packedKey(int eid)
+{
+	const int* header = (const int*)buffer;
+	int keyBits = header[6] & 0xff;
+	int bits = keyBits + ((header[6] >> 8) & 0xff) + ((header[6] >> 16) & 0xff);
+	return header[3] + (int)getBits(buffer + PACKED_HEADER, eid * bits, keyBits);
+}
+
+//read the key and rid of an entry of the packed page
+void BTLeafNode::packedEntry(int eid, int& key, RecordId& rid)
+{
+	const int* header = (const int*)buffer;
+	int keyBits = header[6] & 0xff;
+	int pidBits = (header[6] >> 8) & 0xff;
+	int sidBits = (header[6] >> 16) & 0xff;
+	unsigned pos = eid * (keyBits + pidBits + sidBits);
+	const char* data = buffer + PACKED_HEADER;
+
+	key = header[3] + (int)getBits(data, pos, keyBits);
+	rid.pid = header[4] + (int)getBits(data, pos + keyBits, pidBits);
+	rid.sid = header[5] + (int)getBits(data, pos + keyBits + pidBits, sidBits);
+}
+
+//decode the packed page into the plain layout. the entries are decoded
+//one after the other from a 64-bit word that holds every field of an entry
+void BTLeafNode::unpack()
+{
+	struct leafNode {
+		RecordId rid;
+		int key;
+	};
+
+	char page[PageFile::PAGE_SIZE + sizeof(long long)];
+	memcpy(page, buffer, PageFile::PAGE_SIZE);
+	memset(page + PageFile::PAGE_SIZE, 0, sizeof(long long));
+
+	const int* header = (const int*)page;
+	int count = header[0] & ~PACKED_FLAG;
+	int keyBits = header[6] & 0xff;
+	int pidBits = (header[6] >> 8) & 0xff;
+	int sidBits = (header[6] >> 16) & 0xff;
+	int bits = keyBits + pidBits + sidBits;
+	unsigned long long keyMask = (1ULL << keyBits) - 1;
+	unsigned long long pidMask = (1ULL << pidBits) - 1;
+	unsigned long long sidMask = (1ULL << sidBits) - 1;
+	const char* data = page + PACKED_HEADER;
+
+	struct leafNode* entry = (struct leafNode*)(buffer + sizeof(int));
+	unsigned pos = 0;
+	for (int i = 0; i < count; i++, pos += bits) {
+		//an entry has at most 73 bits: the key is read from one word, and
+		//the rid from the word after it
+		unsigned long long word;
+		memcpy(&word, data + (pos >> 3), sizeof(word));
+		word >>= (pos & 7);
+		entry->key = header[3] + (int)(word & keyMask);
+
+		unsigned ridPos = pos + keyBits;
+		memcpy(&word, data + (ridPos >> 3), sizeof(word));
+		word >>= (ridPos & 7);
+		entry->rid.pid = header[4] + (int)(word & pidMask);
+		entry->rid.sid = header[5] + (int)((word >> pidBits) & sidMask);
+		entry++;
+	}
+
+	packed = false;
+	setKeyCount(count);
+	*(PageId*)entry = header[1];
+	setPrevNodePtr(header[2]);
+	findRidRange();
+}
+
+//pack the plain node into page
+RC BTLeafNode::pack(char* page)
+{
+	struct leafNode {
+		RecordId rid;
+		int key;
+	};
+
+	int count = getKeyCount();
+	struct leafNode* entry = (struct leafNode*)(buffer + sizeof(int));
+
+	//the smallest and largest key (the keys are sorted), pid and sid
+	int minKey = (count > 0) ? entry[0].key : 0;
+	unsigned keyRange = (count > 0) ? (unsigned)entry[count - 1].key - (unsigned)minKey : 0;
+	unsigned pidRange = (count > 0) ? (unsigned)maxPid - (unsigned)minPid : 0;
+	unsigned sidRange = (count > 0) ? (unsigned)maxSid - (unsigned)minSid : 0;
+	if (!fitsPacked(count, keyRange, pidRange, sidRange))
+		return RC_NODE_FULL;
+
+	int keyBits = bitWidth(keyRange);
+	int pidBits = bitWidth(pidRange);
+	int sidBits = bitWidth(sidRange);
+	int bits = keyBits + pidBits + sidBits;
+
+	memset(page, 0, PageFile::PAGE_SIZE + sizeof(long long));
+	int* header = (int*)page;
+	header[0] = count | PACKED_FLAG;
+	header[1] = *(PageId*)(entry + count);
+	header[2] = getPrevNodePtr();
+	header[3] = minKey;
+	header[4] = (count > 0) ? minPid : 0;
+	header[5] = (count > 0) ? minSid : 0;
+	header[6] = keyBits | (pidBits << 8) | (sidBits << 16);
+
+	char* data = page + PACKED_HEADER;
+	unsigned pos = 0;
+	for (int i = 0; i < count; i++, pos += bits) {
+		putBits(data, pos, keyBits, (unsigned)entry[i].key - (unsigned)minKey);
+		putBits(data, pos + keyBits, pidBits, (unsigned)entry[i].rid.pid - (unsigned)minPid);
+		putBits(data, pos + keyBits + pidBits, sidBits, (unsigned)entry[i].rid.sid - (unsigned)minSid);
+	}
+	return 0;
+}
+
+//check whether the plain node still fits in a page, packed, with another entry
+bool BTLeafNode::fitsWith(int key, const RecordId& rid)
+{
+	struct leafNode {
+		RecordId rid;
+		int key;
+	};
+
+	int count = getKeyCount();
+	struct leafNode* entry = (struct leafNode*)(buffer + sizeof(int));
+
+	int minKey = key, maxKey = key;
+	if (count > 0) {
+		if (entry[0].key < minKey) minKey = entry[0].key;
+		if (entry[count - 1].key > maxKey) maxKey = entry[count - 1].key;
+	}
+	int lowPid = (rid.pid < minPid) ? rid.pid : minPid;
+	int highPid = (rid.pid > maxPid) ? rid.pid : maxPid;
+	int lowSid = (rid.sid < minSid) ? rid.sid : minSid;
+	int highSid = (rid.sid > maxSid) ? rid.sid : maxSid;
+	return fitsPacked(count + 1, (unsigned)maxKey - (unsigned)minKey,
+		(unsigned)highPid - (unsigned)lowPid, (unsigned)highSid - (unsigned)lowSid);
+}
+
+//find the range of the pids and sids of the unpacked node
+void BTLeafNode::findRidRange()
+{
+	struct leafNode {
+		RecordId rid;
+		int key;
+	};
+
+	int count = getKeyCount();
+	struct leafNode* entry = (struct leafNode*)(buffer + sizeof(int));
+
+	minPid = minSid = INT_MAX;
+	maxPid = maxSid = INT_MIN;
+	for (int i = 0; i < count; i++) {
+		if (entry[i].rid.pid < minPid) minPid = entry[i].rid.pid;
+		if (entry[i].rid.pid > maxPid) maxPid = entry[i].rid.pid;
+		if (entry[i].rid.sid < minSid) minSid = entry[i].rid.sid;
+		if (entry[i].rid.sid > maxSid) maxSid = entry[i].rid.sid;
+	}
+}
+
 //----------------------------------------------------------------------------
 
 ////////////////////////////////////////////////////////////////////////
@@ -445,9 +768,10 @@ int BTNonLeafNode::getKeyCount()
  * Insert a (key, pid) pair to the node.
  * @param key[IN] the key to insert
  * @param pid[IN] the PageId to insert
+ * @param left[IN] the child that pid was split from (-1 if none)
  * @return 0 if successful. Return an error code if the node is full.
  */
-RC BTNonLeafNode::insert(int key, PageId pid)
+RC BTNonLeafNode::insert(int key, PageId pid, PageId left)
 {
     // check if node has room to add key/pid pair
     if (getKeyCount() == KEYS_PER_NODE) {
@@ -455,20 +779,23 @@ RC BTNonLeafNode::insert(int key, PageId pid)
         return RC_NODE_FULL;
     }
 
-    return insertKey(key, pid);
+    return insertKey(key, pid, left);
 }
 
 
-RC BTNonLeafNode::insertKey(int key, PageId pid) {
+RC BTNonLeafNode::insertKey(int key, PageId pid, PageId left) {
     // position of first PageId/key pair
     int * keyPos = buffer;
 	keyPos += 2;
     int * pidPos = keyPos + 1;
 
     if (keyCount != 0) {
-        // find positions where PageId/key should be inserted
+        // find positions where PageId/key should be inserted: behind the
+        // pointer to left among the keys equal to key, otherwise in front
+        // of the first key >= key
         int pairIndex = 0;
-        while (key > *keyPos && pairIndex < keyCount) {
+        while (pairIndex < keyCount && (key > *keyPos ||
+               (key == *keyPos && left != -1 && *(keyPos - 1) != left))) {
 			keyPos += 2;
             pidPos += 2;
             pairIndex++;
@@ -506,12 +833,13 @@ RC BTNonLeafNode::insertKey(int key, PageId pid) {
  * @param pid[IN] the PageId to insert
  * @param sibling[IN] the sibling node to split with. This node MUST be empty when this function is called.
  * @param midKey[OUT] the key in the middle after the split. This key should be inserted to the parent node.
+ * @param left[IN] the child that pid was split from (-1 if none)
  * @return 0 if successful. Return an error code if there is an error.
  */
-RC BTNonLeafNode::insertAndSplit(int key, PageId pid, BTNonLeafNode& sibling, int& midKey)
+RC BTNonLeafNode::insertAndSplit(int key, PageId pid, BTNonLeafNode& sibling, int& midKey, PageId left)
 {
     // insert (key, pid) pair into this node
-    insertKey(key, pid);
+    insertKey(key, pid, left);
     
     //cout << "BTNonLeafNode.insertAndSplit: (key,pid) (" << key << "," << pid << ") inserted, printing all values before split" << endl;
     //printAllValues();
@@ -567,6 +895,70 @@ RC BTNonLeafNode::locateChildPtr(int searchKey, PageId& pid)
     return 0;
 }
 
+/*
+ * Find the child-node pointer to follow for the first entry whose key is
+ * >= searchKey, and output it in pid, together with the key that follows
+ * the pointer.
+ * @param searchKey[IN] the searchKey that is being looked up.
+ * @param pid[OUT] the pointer to the child node to follow.
+ * @param upperKey[OUT] the key after the pointer (INT_MAX if none).
+ * @return 0 if successful. Return an error code if there is an error.
+ */
+RC BTNonLeafNode::locateFirstChildPtr(int searchKey, PageId& pid, int& upperKey)
+{
+    // pointer to first key
+    int * pos = buffer + 2;
+
+    // look through array for first entry whose key is >= searchKey
+    int count = 0;
+    while (count < keyCount && searchKey > *pos) {
+        pos += 2;
+        count++;
+    }
+
+    // return pid and the key after it
+    pid = *(pos - 1);
+    upperKey = (count < keyCount) ? *pos : INT_MAX;
+    return 0;
+}
+
+/*
+ * Append a (key, pid) pair behind the last pair of the node.
+ * @param key[IN] the key to append (not smaller than the last key)
+ * @param pid[IN] the PageId to append behind the key
+ * @return 0 if successful. Return an error code if the node is full.
+ */
+RC BTNonLeafNode::append(int key, PageId pid)
+{
+    if (keyCount == KEYS_PER_NODE)
+        return RC_NODE_FULL;
+
+    // the pair goes right after the last pointer
+    buffer[2 + 2*keyCount] = key;
+    buffer[3 + 2*keyCount] = pid;
+    keyCount++;
+    *buffer = keyCount;
+    return 0;
+}
+
+/*
+ * Read the eid'th child-node pointer in the node and the key that follows it.
+ * @param eid[IN] the pointer to read (0 to getKeyCount())
+ * @param pid[OUT] the child-node pointer
+ * @param upperKey[OUT] the key after the pointer (INT_MAX if the pointer is the last one)
+ * @return 0 if successful. Return an error code if there is an error.
+ */
+RC BTNonLeafNode::readEntry(int eid, PageId& pid, int& upperKey)
+{
+    if (eid < 0 || eid > keyCount)
+        return RC_INVALID_CURSOR;
+
+    // the pointers and keys alternate after the key count
+    pid = buffer[1 + 2*eid];
+    upperKey = (eid < keyCount) ? buffer[2 + 2*eid] : INT_MAX;
+    return 0;
+}
+
 /*
  * Initialize the root node with (pid1, key, pid2).
  * @param pid1[IN] the first PageId to insert
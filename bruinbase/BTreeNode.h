@@ -17,13 +17,50 @@
 
 /**
  * BTLeafNode: The class representing a B+tree leaf node.
+ * A leaf is either plain, with NUMNODEPTRS-1 (RecordId, key) slots, or
+ * compressed: its keys are stored as deltas from the first key and its
+ * RecordIds as deltas from the smallest pid and sid, every field
+ * bit-packed in the fewest bits that hold its largest delta, so that a
+ * leaf holds as many entries as fit in the page when packed.
+ * A compressed leaf read from disk is used in its packed form by
+ * locate() and readEntry(), and unpacked only when it is changed.
  */
 class BTLeafNode {
   public:
 
+	// the most entries in a compressed leaf. a leaf with one entry more
+	// splits into halves that always fit in a page, even with 32-bit
+	// key deltas, 31-bit pid deltas and 10-bit sid deltas
+	static const int PACKED_HEADER = 7 * sizeof(int);
+	static const int MAX_ENTRY_BITS = 32 + 31 + 10;
+	static const int MAX_PACKED_KEYS = (PageFile::PAGE_SIZE - PACKED_HEADER) * 8 / MAX_ENTRY_BITS * 2 - 1;
+
 	//constructor
 	BTLeafNode();
 
+   /**
+    * Make the node a compressed leaf (or a plain one), which decides the
+    * format it is written in. A node read from disk keeps the format of
+    * its page, and the sibling of a split gets the format of the node.
+    * @param compressed[IN] true for a compressed leaf
+    */
+    void setCompressed(bool compressed);
+
+   /**
+    * @return true if the node is a compressed leaf
+    */
+    bool isCompressed();
+
+   /**
+    * Check whether entries fit in a compressed leaf.
+    * @param count[IN] the # entries
+    * @param keyRange[IN] the largest key minus the smallest key
+    * @param pidRange[IN] the largest pid minus the smallest pid
+    * @param sidRange[IN] the largest sid minus the smallest sid
+    * @return true if the entries fit in one page when packed
+    */
+    static bool fitsPacked(int count, unsigned keyRange, unsigned pidRange, unsigned sidRange);
+
    /**
     * Insert the (key, rid) pair to the node.
     * Remember that all keys inside a B+tree node should be kept sorted.
@@ -87,6 +124,19 @@ class BTLeafNode {
     */
     RC setNextNodePtr(PageId pid);
 
+   /**
+    * Return the pid of the previous slibling node.
+    * @return the PageId of the previous sibling node (-1 for the first leaf)
+    */
+    PageId getPrevNodePtr();
+
+   /**
+    * Set the previous slibling node PageId.
+    * @param pid[IN] the PageId of the previous sibling node 
+    * @return 0 if successful. Return an error code if there is an error.
+    */
+    RC setPrevNodePtr(PageId pid);
+
    /**
     * Return the number of keys stored in the node.
     * @return the number of keys in the node
@@ -119,12 +169,48 @@ class BTLeafNode {
 
 
   private:
+	// the flag in the first int of a compressed page (next to the key count)
+	static const int PACKED_FLAG = 0x40000000;
+
+	// the buffer holds a full compressed leaf unpacked, with one more
+	// entry during a split, the nextNodePtr and the prevNodePtr (which
+	// is kept in its last bytes)
+	static const int BUFFER_SIZE = sizeof(int) + (MAX_PACKED_KEYS + 1) * (sizeof(RecordId) + sizeof(int)) + 2 * sizeof(PageId);
+
    /**
     * The main memory buffer for loading the content of the disk page 
     * that contains the node.
     */
 	//NOTE: each buffer begins with an int indicating the number of keys in the node
-    char buffer[PageFile::PAGE_SIZE];
+    char buffer[BUFFER_SIZE];
+
+	bool compressed;  // true if the node is written in the packed format
+	bool packed;      // true if buffer holds the packed page as it was read
+
+	// the smallest and largest pid and sid of the entries of an unpacked
+	// node (INT_MAX and INT_MIN if it is empty), kept up to date by inserts
+	int minPid, maxPid, minSid, maxSid;
+
+	// the packed form of the node:
+	// int 0: key count | PACKED_FLAG, int 1: nextNodePtr, int 2: prevNodePtr,
+	// int 3-5: the smallest key, pid and sid, int 6: the # bits of the key,
+	// pid and sid deltas (a byte each), followed by the bit-packed entries
+
+	// read the key and rid of an entry of the packed page
+	int packedKey(int eid);
+	void packedEntry(int eid, int& key, RecordId& rid);
+
+	// turn the packed page into the plain layout in buffer
+	void unpack();
+
+	// pack the node into page (PAGE_SIZE bytes and 8 bytes of slack)
+	RC pack(char* page);
+
+	// check whether the node still fits in a page with another entry
+	bool fitsWith(int key, const RecordId& rid);
+
+	// find minPid, maxPid, minSid and maxSid of the unpacked node
+	void findRidRange();
 	
 //helper functions:
 
@@ -161,11 +247,16 @@ class BTNonLeafNode {
    /**
     * Insert a (key, pid) pair to the node.
     * Remember that all keys inside a B+tree node should be kept sorted.
+    * When a child is split, the pair of its new sibling goes right behind
+    * the pointer to the child: with duplicate keys, the node may already
+    * have keys equal to key on both sides of it.
     * @param key[IN] the key to insert
     * @param pid[IN] the PageId to insert
+    * @param left[IN] the child that pid was split from (-1: the pair goes
+    *                 in front of the first key >= key)
     * @return 0 if successful. Return an error code if the node is full.
     */
-    RC insert(int key, PageId pid);
+    RC insert(int key, PageId pid, PageId left = -1);
 
    /**
     * Insert the (key, pid) pair to the node
@@ -177,9 +268,10 @@ class BTNonLeafNode {
     * @param pid[IN] the PageId to insert
     * @param sibling[IN] the sibling node to split with. This node MUST be empty when this function is called.
     * @param midKey[OUT] the key in the middle after the split. This key should be inserted to the parent node.
+    * @param left[IN] the child that pid was split from (see insert())
     * @return 0 if successful. Return an error code if there is an error.
     */
-    RC insertAndSplit(int key, PageId pid, BTNonLeafNode& sibling, int& midKey);
+    RC insertAndSplit(int key, PageId pid, BTNonLeafNode& sibling, int& midKey, PageId left = -1);
 
    /**
     * Given the searchKey, find the child-node pointer to follow and
@@ -191,6 +283,43 @@ class BTNonLeafNode {
     */
     RC locateChildPtr(int searchKey, PageId& pid);
 
+   /**
+    * Find the child-node pointer to follow for the first entry whose key
+    * is >= searchKey: the pointer in front of the first key >= searchKey.
+    * Unlike locateChildPtr(), it goes left of a key equal to searchKey,
+    * since a leaf split inside a run of equal keys leaves copies of the
+    * key on both sides of it. All keys under the child node are smaller
+    * than or equal to the key that follows the pointer.
+    * @param searchKey[IN] the searchKey that is being looked up.
+    * @param pid[OUT] the pointer to the child node to follow.
+    * @param upperKey[OUT] the key after the pointer (INT_MAX if the
+    *                      pointer is the last one in the node).
+    * @return 0 if successful. Return an error code if there is an error.
+    */
+    RC locateFirstChildPtr(int searchKey, PageId& pid, int& upperKey);
+
+   /**
+    * Read the eid'th child-node pointer in the node and the key that
+    * follows it. All keys under the child node are smaller than this key
+    * and at least as large as the key in front of the pointer.
+    * @param eid[IN] the pointer to read (0 to getKeyCount())
+    * @param pid[OUT] the child-node pointer
+    * @param upperKey[OUT] the key after the pointer (INT_MAX if the
+    *                      pointer is the last one in the node).
+    * @return 0 if successful. Return an error code if there is an error.
+    */
+    RC readEntry(int eid, PageId& pid, int& upperKey);
+
+   /**
+    * Append a (key, pid) pair behind the last pair of the node, for
+    * building a node from keys that come in ascending order. Unlike
+    * insert(), a key equal to the last key goes behind it.
+    * @param key[IN] the key to append (not smaller than the last key)
+    * @param pid[IN] the PageId to append behind the key
+    * @return 0 if successful. Return an error code if the node is full.
+    */
+    RC append(int key, PageId pid);
+
    /**
     * Initialize the root node with (pid1, key, pid2).
     * @param pid1[IN] the first PageId to insert
@@ -226,7 +355,7 @@ class BTNonLeafNode {
      void printAllValues();
 
   private:
-    RC insertKey(int key, PageId pid);
+    RC insertKey(int key, PageId pid, PageId left);
   
     int keyCount;
    /**
@@ -0,0 +1,127 @@
+/**
+ * BatchFormat: the binary format of LOAD and COPY ... TO.
+ */
+
+#include <cstring>
+#include "BatchFormat.h"
+
+using std::vector;
+
+const char BatchFormat::MAGIC[8] = { '\x89', 'B', 'R', 'B', '\r', '\n', '\x1a', '\n' };
+
+bool BatchFormat::isBatchFile(const char* data)
+{
+  return memcmp(data, MAGIC, MAGIC_SIZE) == 0;
+}
+
+unsigned BatchFormat::getInt(const char* p)
+{
+  const unsigned char* u = (const unsigned char*)p;
+  return u[0] | (u[1] << 8) | (u[2] << 16) | ((unsigned)u[3] << 24);
+}
+
+void BatchFormat::putInt(char* p, unsigned n)
+{
+  p[0] = (char)n;
+  p[1] = (char)(n >> 8);
+  p[2] = (char)(n >> 16);
+  p[3] = (char)(n >> 24);
+}
+
+void BatchFormat::readHeader(const char* data, unsigned& count, unsigned& size)
+{
+  count = getInt(data);
+  size = getInt(data + 4);
+}
+
+RC BatchFormat::decode(const char* begin, const char* end, vector<RecordRef>& tuples)
+{
+  RecordRef tuple;
+  unsigned  count, size;
+
+  while (begin < end) {
+    if (end - begin < HEADER_SIZE) return RC_INVALID_FILE_FORMAT;
+    readHeader(begin, count, size);
+    begin += HEADER_SIZE;
+    if (count == 0) break;
+
+    // the columns of keys and lengths, and the values after them
+    if ((size_t)(end - begin) < size || size / 8 < count)
+      return RC_INVALID_FILE_FORMAT;
+    const char* key = begin;
+    const char* length = begin + 4 * count;
+    const char* value = begin + 8 * count;
+    const char* last = begin + size;
+    begin = last;
+
+    for (unsigned i = 0; i < count; i++, key += 4, length += 4) {
+      tuple.key = (int)getInt(key);
+      tuple.length = (int)getInt(length);
+      if (tuple.length < 0 || tuple.length > last - value)
+        return RC_INVALID_FILE_FORMAT;
+      tuple.value = value;
+      value += tuple.length;
+      tuples.push_back(tuple);
+    }
+    if (value != last) return RC_INVALID_FILE_FORMAT;
+  }
+  return 0;
+}
+
+BatchWriter::BatchWriter()
+{
+  file = NULL;
+  count = 0;
+}
+
+RC BatchWriter::open(FILE* file)
+{
+  this->file = file;
+  count = 0;
+  keys.resize(4 * BatchFormat::BATCH_TUPLES);
+  lengths.resize(4 * BatchFormat::BATCH_TUPLES);
+  values.clear();
+  if (fwrite(BatchFormat::MAGIC, 1, BatchFormat::MAGIC_SIZE, file) != (size_t)BatchFormat::MAGIC_SIZE)
+    return RC_FILE_WRITE_FAILED;
+  return 0;
+}
+
+RC BatchWriter::write(int key, const char* value, int length)
+{
+  BatchFormat::putInt(&keys[4 * count], key);
+  BatchFormat::putInt(&lengths[4 * count], length);
+  values.append(value, length);
+  if (++count == (unsigned)BatchFormat::BATCH_TUPLES)
+    return flushBatch();
+  return 0;
+}
+
+RC BatchWriter::flushBatch()
+{
+  char header[BatchFormat::HEADER_SIZE];
+
+  if (count == 0) return 0;
+  BatchFormat::putInt(header, count);
+  BatchFormat::putInt(header + 4, 8 * count + values.size());
+  if (fwrite(header, 1, sizeof(header), file) != sizeof(header) ||
+      fwrite(&keys[0], 4, count, file) != count ||
+      fwrite(&lengths[0], 4, count, file) != count ||
+      fwrite(values.data(), 1, values.size(), file) != values.size())
+    return RC_FILE_WRITE_FAILED;
+  count = 0;
+  values.clear();
+  return 0;
+}
+
+RC BatchWriter::close()
+{
+  RC   rc;
+  char header[BatchFormat::HEADER_SIZE];
+
+  if ((rc = flushBatch()) < 0) return rc;
+  BatchFormat::putInt(header, 0);
+  BatchFormat::putInt(header + 4, 0);
+  if (fwrite(header, 1, sizeof(header), file) != sizeof(header))
+    return RC_FILE_WRITE_FAILED;
+  return 0;
+}
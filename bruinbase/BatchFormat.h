@@ -0,0 +1,110 @@
+/**
+ * BatchFormat is the binary format that LOAD reads and COPY ... TO
+ * writes, so that tables move between Bruinbase instances without being
+ * printed and parsed as text. A file starts with the bytes of
+ * BatchFormat::MAGIC, followed by batches of tuples that are stored
+ * column by column:
+ *
+ *   count         # tuples in the batch (a batch with 0 ends the file)
+ *   size          # bytes of the batch after these two fields
+ *   key[count]    the keys of the tuples
+ *   length[count] the lengths of their values
+ *   the values, one after the other
+ *
+ * all fields are 32-bit little-endian integers.
+ */
+
+#ifndef BATCHFORMAT_H
+#define BATCHFORMAT_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Bruinbase.h"
+#include "RecordFile.h"
+
+class BatchFormat {
+ public:
+
+  // the first bytes of a batch file
+  static const char MAGIC[8];
+  static const int  MAGIC_SIZE = 8;
+
+  // # bytes of the count and size of a batch
+  static const int  HEADER_SIZE = 8;
+
+  // # tuples in a batch that BatchWriter writes
+  static const int  BATCH_TUPLES = 4096;
+
+  /**
+   * @param data[IN] the first bytes of a file (at least MAGIC_SIZE)
+   * @return true if the file is a batch file
+   */
+  static bool isBatchFile(const char* data);
+
+  /**
+   * read the count and size of a batch.
+   * @param data[IN] the header of the batch (HEADER_SIZE bytes)
+   * @param count[OUT] the # tuples in the batch
+   * @param size[OUT] the # bytes of the batch after its header
+   */
+  static void readHeader(const char* data, unsigned& count, unsigned& size);
+
+  /**
+   * decode the tuples of the batches in [begin, end). the values of the
+   * tuples point into the batches.
+   * @param begin[IN] the start of the first batch
+   * @param end[IN] the end of the last batch
+   * @param tuples[OUT] the tuples of the batches are appended to it,
+   * up to the first batch that is not well-formed
+   * @return error code. 0 if no error
+   */
+  static RC decode(const char* begin, const char* end, std::vector<RecordRef>& tuples);
+
+  // read and write a little-endian 32-bit integer
+  static unsigned getInt(const char* p);
+  static void putInt(char* p, unsigned n);
+};
+
+/**
+ * BatchWriter writes tuples to a file in the batch format.
+ */
+class BatchWriter {
+ public:
+  BatchWriter();
+
+  /**
+   * start a batch file by writing its magic bytes.
+   * @param file[IN] the file that the batches are written to
+   * @return error code. 0 if no error
+   */
+  RC open(FILE* file);
+
+  /**
+   * add a tuple to the current batch; a full batch is written out.
+   * @param key[IN] the key of the tuple
+   * @param value[IN] the value of the tuple
+   * @param length[IN] the length of the value
+   * @return error code. 0 if no error
+   */
+  RC write(int key, const char* value, int length);
+
+  /**
+   * write the last batch and the end of the file. the file itself is
+   * left open.
+   * @return error code. 0 if no error
+   */
+  RC close();
+
+ private:
+  // write the tuples of the current batch
+  RC flushBatch();
+
+  FILE*             file;
+  std::vector<char> keys;     // the key column of the current batch
+  std::vector<char> lengths;  // the length column of the current batch
+  std::string       values;   // the values of the current batch
+  unsigned          count;    // # tuples in the current batch
+};
+
+#endif // BATCHFORMAT_H
@@ -0,0 +1,219 @@
+/**
+ * HashAggregate: hash aggregation of the tuples of a query for GROUP BY.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include "HashAggregate.h"
+
+using std::string;
+
+HashAggregate::HashAggregate(int groupAttr, int bestAttr, bool desc, int depth)
+{
+  this->groupAttr = groupAttr;
+  this->bestAttr = bestAttr;
+  this->desc = desc;
+  this->depth = depth;
+  slots.assign(1024, -1);
+  blockUsed = ARENA_BLOCK;
+  bytes = slots.size() * sizeof(int);
+  spilled = false;
+  next = 0;
+  partition = 0;
+  child = NULL;
+}
+
+HashAggregate::~HashAggregate()
+{
+  delete child;
+  removePartitions();
+  for (unsigned i = 0; i < blocks.size(); i++) {
+    delete [] blocks[i];
+  }
+}
+
+// 32-bit FNV-1a hash of the group value, started from the seed
+unsigned HashAggregate::hash(const char* data, int length, unsigned seed)
+{
+  unsigned h = 2166136261u ^ (seed * 16777619u);
+  for (int i = 0; i < length; i++) {
+    h ^= (unsigned char)data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+const char* HashAggregate::allocate(const char* data, int length)
+{
+  // a value that does not fit in the rest of the block starts a new one.
+  // values are at most a page long, so they always fit in a new block
+  if (blockUsed + length > ARENA_BLOCK) {
+    blocks.push_back(new char[ARENA_BLOCK]);
+    blockUsed = 0;
+    bytes += ARENA_BLOCK;
+  }
+  char* p = blocks.back() + blockUsed;
+  memcpy(p, data, length);
+  blockUsed += length;
+  return p;
+}
+
+void HashAggregate::grow()
+{
+  unsigned mask = slots.size() * 2 - 1;
+  bytes += slots.size() * sizeof(int);
+  slots.assign(slots.size() * 2, -1);
+  for (unsigned i = 0; i < entries.size(); i++) {
+    unsigned s = entries[i].hash & mask;
+    while (slots[s] >= 0) s = (s + 1) & mask;
+    slots[s] = i;
+  }
+}
+
+void HashAggregate::update(Entry& entry, int key, const string& value)
+{
+  entry.count++;
+  entry.sum += key;
+
+  if (bestAttr == 0) return;
+
+  // MIN and MAX: ties are broken by the key, as in ORDER BY
+  bool better;
+  if (entry.count == 1) {
+    better = true;
+  } else if (bestAttr == 2 && value != entry.bestValue) {
+    better = desc ? (value > entry.bestValue) : (value < entry.bestValue);
+  } else if (bestAttr == 1 && desc) {
+    better = (key > entry.bestKey);
+  } else {
+    better = (key < entry.bestKey);
+  }
+  if (better) {
+    entry.bestKey = key;
+    if (bestAttr == 2) {
+      bytes += (long)value.size() - (long)entry.bestValue.size();
+      entry.bestValue = value;
+    }
+  }
+}
+
+RC HashAggregate::add(int key, const string& value)
+{
+  const char* data = (groupAttr == 1) ? (const char*)&key : value.data();
+  int length = (groupAttr == 1) ? sizeof(int) : value.size();
+  unsigned h = hash(data, length, depth);
+
+  // linear probing from the home slot of the hash
+  unsigned mask = slots.size() - 1;
+  unsigned s = h & mask;
+  for (; slots[s] >= 0; s = (s + 1) & mask) {
+    Entry& e = entries[slots[s]];
+    if (e.hash == h && e.length == length && memcmp(e.data, data, length) == 0) {
+      update(e, key, value);
+      return 0;
+    }
+  }
+
+  // a new group: once the memory is full, the tuples of new groups go to
+  // the partition files. the groups in the table keep being aggregated
+  if (spilled) return spill(h, key, value);
+
+  Entry e;
+  e.data = allocate(data, length);
+  e.length = length;
+  e.hash = h;
+  e.count = 0;
+  e.sum = 0;
+  e.bestKey = 0;
+  entries.push_back(e);
+  slots[s] = entries.size() - 1;
+  bytes += sizeof(Entry);
+  update(entries.back(), key, value);
+
+  // keep the table at most half full
+  if (entries.size() * 2 > slots.size()) grow();
+
+  if (bytes > MEMORY && depth < MAX_DEPTH) spilled = true;
+  return 0;
+}
+
+RC HashAggregate::spill(unsigned h, int key, const string& value)
+{
+  RC       rc;
+  RecordId rid;
+  char     name[64];
+
+  if (partitions.empty()) {
+    for (int p = 0; p < PARTITIONS; p++) {
+      sprintf(name, ".group-%d-%d-%d.tmp", (int)getpid(), depth, p);
+      names.push_back(name);
+      partitions.push_back(new RecordFile);
+      if ((rc = partitions.back()->open(name, 'w')) < 0) return rc;
+    }
+  }
+
+  // the partition is picked by the bits of the hash above the ones that
+  // picked the slot, so that the groups of a partition are spread evenly
+  return partitions[(h >> 24) % PARTITIONS]->append(key, value, rid);
+}
+
+RC HashAggregate::openPartition()
+{
+  RC       rc;
+  RecordId rid;
+  int      key;
+  string   value;
+
+  RecordFile* rf = partitions[partition];
+  child = new HashAggregate(groupAttr, bestAttr, desc, depth + 1);
+  for (rid.pid = rid.sid = 0; rid < rf->endRid(); ++rid) {
+    if ((rc = rf->read(rid, key, value)) < 0) return rc;
+    if ((rc = child->add(key, value)) < 0) return rc;
+  }
+  return 0;
+}
+
+void HashAggregate::removePartitions()
+{
+  for (unsigned p = 0; p < partitions.size(); p++) {
+    partitions[p]->close();
+    delete partitions[p];
+    unlink(names[p].c_str());
+  }
+  partitions.clear();
+  names.clear();
+}
+
+RC HashAggregate::getGroup(Group& group)
+{
+  RC rc;
+
+  // the groups in the hash table first
+  if (next < entries.size()) {
+    Entry& e = entries[next++];
+    if (groupAttr == 1) {
+      memcpy(&group.key, e.data, sizeof(int));
+      group.value.clear();
+    } else {
+      group.key = 0;
+      group.value.assign(e.data, e.length);
+    }
+    group.count = e.count;
+    group.sum = e.sum;
+    group.bestKey = e.bestKey;
+    group.bestValue = e.bestValue;
+    return 0;
+  }
+
+  // then the groups of the partitions, one partition at a time
+  while (partition < partitions.size()) {
+    if (child == NULL && (rc = openPartition()) < 0) return rc;
+    if ((rc = child->getGroup(group)) != RC_END_OF_TREE) return rc;
+    delete child;
+    child = NULL;
+    partition++;
+  }
+  removePartitions();
+  return RC_END_OF_TREE;
+}
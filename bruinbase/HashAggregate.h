@@ -0,0 +1,125 @@
+/**
+ * HashAggregate groups the tuples of a query by their key or value and
+ * computes COUNT, SUM, MIN and MAX for every group (GROUP BY).
+ * The groups are kept in an open-addressing hash table whose group
+ * values are copied into a memory arena. When the table outgrows its
+ * memory budget, the tuples of the groups that are not in the table yet
+ * are written to temporary partition files instead, and every partition
+ * is aggregated on its own once the table has been read out.
+ */
+
+#ifndef HASHAGGREGATE_H
+#define HASHAGGREGATE_H
+
+#include <string>
+#include <vector>
+#include "Bruinbase.h"
+#include "RecordFile.h"
+
+class HashAggregate {
+ public:
+
+  // # bytes of groups that are kept in memory
+  static const int MEMORY = 1 << 20;
+
+  // # partitions that the tuples are written to once the memory is full,
+  // and the maximum # times a partition that is still too large is
+  // partitioned again
+  static const int PARTITIONS = 16;
+  static const int MAX_DEPTH = 3;
+
+  // size of a block of the arena that holds the group values
+  static const int ARENA_BLOCK = 64 * 1024;
+
+  /**
+   * a group and its aggregates
+   */
+  struct Group {
+    int         key;    // GROUP BY key: the key of the group
+    std::string value;  // GROUP BY value: the value of the group
+    int         count;  // # tuples in the group
+    long long   sum;    // the sum of their keys
+    int         bestKey;         // MIN and MAX: the key of the best tuple
+    std::string bestValue;       // MIN and MAX: the value of the best tuple
+  };
+
+  /**
+   * @param groupAttr[IN] the attribute in GROUP BY (1: key, 2: value)
+   * @param bestAttr[IN] the attribute of MIN or MAX (1: key, 2: value),
+   * 0 if the query has neither
+   * @param desc[IN] true for MAX, false for MIN
+   * @param depth[IN] the # times the tuples have been partitioned
+   */
+  HashAggregate(int groupAttr, int bestAttr, bool desc, int depth = 0);
+  ~HashAggregate();
+
+  /**
+   * add a tuple to its group.
+   * @param key[IN] the key of the tuple
+   * @param value[IN] the value of the tuple
+   * @return error code. 0 if no error
+   */
+  RC add(int key, const std::string& value);
+
+  /**
+   * read out the next group once all tuples have been added.
+   * the groups come in no particular order.
+   * @param group[OUT] the next group
+   * @return error code. 0 if no error, RC_END_OF_TREE after the last group
+   */
+  RC getGroup(Group& group);
+
+ private:
+  // a group in the hash table
+  typedef struct {
+    const char* data;    // the group value in the arena
+    int         length;  // its length in bytes
+    unsigned    hash;    // hash of the group value
+    int         count;
+    long long   sum;
+    int         bestKey;
+    std::string bestValue;
+  } Entry;
+
+  // hash of a group value; the seed differs on every partitioning depth
+  static unsigned hash(const char* data, int length, unsigned seed);
+
+  // copy a group value into the arena
+  const char* allocate(const char* data, int length);
+
+  // double the # slots and re-insert the groups
+  void grow();
+
+  // update the aggregates of a group with a tuple
+  void update(Entry& entry, int key, const std::string& value);
+
+  // write a tuple to its partition file
+  RC spill(unsigned h, int key, const std::string& value);
+
+  // aggregate the next partition file in a child HashAggregate
+  RC openPartition();
+
+  // remove the partition files
+  void removePartitions();
+
+  int  groupAttr;
+  int  bestAttr;
+  bool desc;
+  int  depth;
+
+  std::vector<int>   slots;    // index of the group in entries, -1 if empty
+  std::vector<Entry> entries;  // the groups in the hash table
+  std::vector<char*> blocks;   // the blocks of the arena
+  int  blockUsed;              // # bytes used in the last block
+  long bytes;                  // # bytes of memory taken by the groups
+
+  bool spilled;                         // true once tuples are partitioned
+  std::vector<RecordFile*> partitions;  // the partition files
+  std::vector<std::string> names;       // their file names
+
+  unsigned       next;       // the next group in entries to read out
+  unsigned       partition;  // the partition that child aggregates
+  HashAggregate* child;      // the aggregate of the current partition
+};
+
+#endif // HASHAGGREGATE_H
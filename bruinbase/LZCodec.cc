@@ -0,0 +1,125 @@
+/**
+ * LZCodec: an LZ77 block codec in the style of LZ4.
+ */
+
+#include <cstring>
+#include "LZCodec.h"
+
+// the matches are found through a hash table of the positions of
+// 4-byte sequences
+static const int HASH_BITS = 12;
+static const int MAX_OFFSET = 65535;
+
+static unsigned read32(const char* p)
+{
+  unsigned n;
+  memcpy(&n, p, sizeof(n));
+  return n;
+}
+
+static int hashOf(unsigned n)
+{
+  return (int)((n * 2654435761U) >> (32 - HASH_BITS));
+}
+
+// write a length field that did not fit in its 4 bits of the token
+static char* putLength(char* out, int length)
+{
+  for (; length >= 255; length -= 255) *out++ = (char)255;
+  *out++ = (char)length;
+  return out;
+}
+
+// write a sequence: the literals and the match after them (if length > 0)
+static char* putSequence(char* out, const char* literals, int literalCount, int offset, int length)
+{
+  int matchField = (length > 0) ? length - LZCodec::MIN_MATCH : 0;
+  *out++ = (char)(((literalCount < 15 ? literalCount : 15) << 4) | (matchField < 15 ? matchField : 15));
+  if (literalCount >= 15) out = putLength(out, literalCount - 15);
+  memcpy(out, literals, literalCount);
+  out += literalCount;
+  if (length > 0) {
+    *out++ = (char)offset;
+    *out++ = (char)(offset >> 8);
+    if (matchField >= 15) out = putLength(out, matchField - 15);
+  }
+  return out;
+}
+
+int LZCodec::compress(const char* src, int size, char* dst)
+{
+  int   table[1 << HASH_BITS];
+  char* out = dst;
+  int   anchor = 0;  // the first byte that is not encoded yet
+
+  memset(table, 0xff, sizeof(table));
+  for (int i = 0; i + MIN_MATCH <= size; ) {
+    unsigned sequence = read32(src + i);
+    int h = hashOf(sequence);
+    int candidate = table[h];
+    table[h] = i;
+    if (candidate < 0 || i - candidate > MAX_OFFSET || read32(src + candidate) != sequence) {
+      i++;
+      continue;
+    }
+
+    // extend the match as far as it goes (it may overlap the bytes it
+    // copies, which encodes a run of a repeated byte)
+    int length = MIN_MATCH;
+    while (i + length < size && src[candidate + length] == src[i + length]) length++;
+    out = putSequence(out, src + anchor, i - anchor, i - candidate, length);
+    i += length;
+    anchor = i;
+  }
+
+  // the rest of the block is literals
+  out = putSequence(out, src + anchor, size - anchor, 0, 0);
+  return out - dst;
+}
+
+// read a length field continued after the token
+static bool getLength(const unsigned char*& in, const unsigned char* end, int& length)
+{
+  unsigned char c;
+  do {
+    if (in >= end) return false;
+    c = *in++;
+    length += c;
+  } while (c == 255);
+  return true;
+}
+
+int LZCodec::decompress(const char* src, int size, char* dst, int capacity)
+{
+  const unsigned char* in = (const unsigned char*)src;
+  const unsigned char* end = in + size;
+  char* out = dst;
+  char* last = dst + capacity;
+
+  while (in < end) {
+    int token = *in++;
+
+    // the literals
+    int literalCount = token >> 4;
+    if (literalCount == 15 && !getLength(in, end, literalCount)) return -1;
+    if (literalCount > end - in || literalCount > last - out) return -1;
+    memcpy(out, in, literalCount);
+    in += literalCount;
+    out += literalCount;
+
+    // the last sequence ends with its literals
+    if (in == end) break;
+
+    // the match, copied byte by byte since it may overlap itself
+    if (end - in < 2) return -1;
+    int offset = in[0] | (in[1] << 8);
+    in += 2;
+    int length = token & 15;
+    if (length == 15 && !getLength(in, end, length)) return -1;
+    length += MIN_MATCH;
+    if (offset == 0 || offset > out - dst || length > last - out) return -1;
+    const char* match = out - offset;
+    for (int i = 0; i < length; i++) *out++ = *match++;
+  }
+  return out - dst;
+}
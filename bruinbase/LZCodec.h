@@ -0,0 +1,52 @@
+/**
+ * LZCodec is a small LZ77 block codec in the style of LZ4, for blocks of
+ * a few kilobytes such as compressed pages. A compressed block is a
+ * sequence of
+ *
+ *   token         the # literals (high 4 bits) and the match length
+ *                 minus MIN_MATCH (low 4 bits). a field of 15 is
+ *                 continued by bytes that are added to it, up to the
+ *                 first byte that is not 255
+ *   literals      the bytes that are copied as they are
+ *   offset        how far back the match starts (16 bits, little-endian)
+ *
+ * the last sequence has only literals: the block ends after them.
+ */
+
+#ifndef LZCODEC_H
+#define LZCODEC_H
+
+class LZCodec {
+ public:
+
+  // the shortest match that is encoded
+  static const int MIN_MATCH = 4;
+
+  /**
+   * @param size[IN] the # bytes of a block
+   * @return the most bytes that compress() writes for it
+   */
+  static int maxCompressedSize(int size) { return size + size / 255 + 16; }
+
+  /**
+   * compress a block.
+   * @param src[IN] the block
+   * @param size[IN] the # bytes of the block
+   * @param dst[OUT] the compressed block (maxCompressedSize(size) bytes)
+   * @return the # bytes of the compressed block
+   */
+  static int compress(const char* src, int size, char* dst);
+
+  /**
+   * decompress a block.
+   * @param src[IN] the compressed block
+   * @param size[IN] the # bytes of the compressed block
+   * @param dst[OUT] the block
+   * @param capacity[IN] the # bytes that dst can hold
+   * @return the # bytes of the block (-1 if the compressed block is not
+   * well-formed or the block does not fit in dst)
+   */
+  static int decompress(const char* src, int size, char* dst, int capacity);
+};
+
+#endif // LZCODEC_H
@@ -9,30 +9,51 @@
 
 #include "Bruinbase.h"
 #include "PageFile.h"
+#include <cstring>
 #include <fcntl.h>
+#include <unistd.h>
 #include <sys/stat.h>
+#include <pthread.h>
 
 using std::string;
+using std::vector;
+
+const char PageFile::COMPRESSED_MAGIC[8] = { '\x89', 'B', 'R', 'Z', '\r', '\n', '\x1a', '\n' };
 
 int PageFile::readCount = 0;
 int PageFile::writeCount = 0;
 int PageFile::cacheClock = 1;
 struct PageFile::cacheStruct PageFile::readCache[PageFile::CACHE_COUNT];
 
+// the cache is shared by the threads of a query. the lock protects the
+// cache slots and the clock, and writeClock is increased (under the lock)
+// on every write, so that a page read from disk is not cached if the
+// page may have been written meanwhile.
+static pthread_mutex_t cacheLock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned writeClock = 0;
+
 PageFile::PageFile() 
 { 
   fd = -1; 
   epid = 0; 
+  codec = NULL;
+  dataEnd = 0;
+  directoryEnd = 0;
+  directoryDirty = false;
 }
 
 PageFile::PageFile(const string& filename, char mode)
 {
   fd = -1;
   epid = 0;
+  codec = NULL;
+  dataEnd = 0;
+  directoryEnd = 0;
+  directoryDirty = false;
   open(filename.c_str(), mode);
 }
 
-RC PageFile::open(const string& filename, char mode)
+RC PageFile::open(const string& filename, char mode, const PageCodec* codec, bool compress)
 {
   RC   rc;
   int  oflag;
@@ -62,18 +83,52 @@ RC PageFile::open(const string& filename, char mode)
   rc = ::fstat(fd, &statbuf);
   if (rc < 0) { ::close(fd); fd = -1; return RC_FILE_OPEN_FAILED; }
   epid = statbuf.st_size / PAGE_SIZE;
+  if (codec == NULL) return 0;
+
+  // a new file is created compressed if asked to, and an existing one
+  // is compressed if it starts with the magic bytes
+  char magic[sizeof(COMPRESSED_MAGIC)];
+  if (statbuf.st_size == 0 && compress && oflag != O_RDONLY) {
+    this->codec = codec;
+    dataEnd = FIRST_BLOCK;
+    if (::pwrite(fd, COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC), 0) < 0 ||
+        (rc = writeDirectory()) < 0) {
+      close();
+      return RC_FILE_WRITE_FAILED;
+    }
+  } else if (statbuf.st_size >= (off_t)sizeof(magic) &&
+             ::pread(fd, magic, sizeof(magic), 0) == (ssize_t)sizeof(magic) &&
+             memcmp(magic, COMPRESSED_MAGIC, sizeof(magic)) == 0) {
+    this->codec = codec;
+    dataEnd = statbuf.st_size;
+    if ((rc = readDirectory()) < 0) {
+      close();
+      return rc;
+    }
+  }
 
   return 0;
 }
 
 RC PageFile::close()
 {
+  RC rc = 0;
+
   if (fd <= 0) return RC_FILE_CLOSE_FAILED;
 
+  // the directory of a compressed file goes after its blocks
+  if (codec != NULL && directoryDirty) rc = writeDirectory();
+  codec = NULL;
+  offsets.clear();
+  lengths.clear();
+  dataEnd = 0;
+  directoryEnd = 0;
+
   // close the file
   if (::close(fd) < 0) return RC_FILE_CLOSE_FAILED;
 
   // evict all cached pages for this file
+  pthread_mutex_lock(&cacheLock);
   for (int i = 0; i < CACHE_COUNT; i++) {
     if (readCache[i].fd == fd && readCache[i].lastAccessed != 0) {
        readCache[i].fd = 0;
@@ -81,11 +136,12 @@ RC PageFile::close()
        readCache[i].lastAccessed = 0;
     }
   }
+  pthread_mutex_unlock(&cacheLock);
 
   // set the fd and epid to the initial state
   fd = -1; 
   epid = 0;
-  return 0;
+  return rc;
 }
 
 PageId PageFile::endPid() const 
@@ -100,16 +156,18 @@ RC PageFile::seek(PageId pid) const
 
 RC PageFile::write(PageId pid, const void* buffer)
 {
-  RC rc;
   if (pid < 0) return RC_INVALID_PID; 
 
-  // seek to the location of the page
-  if ((rc = seek(pid) < 0)) return rc;
-
-  // write the buffer to the disk page
-  if (::write(fd, buffer, PAGE_SIZE) < 0) return RC_FILE_WRITE_FAILED;
+  // write the buffer to the disk page. pwrite does not move the shared
+  // file cursor, so that other threads can read the file meanwhile
+  if (codec != NULL) {
+    RC rc = writeBlock(pid, buffer);
+    if (rc < 0) return rc;
+  } else if (::pwrite(fd, buffer, PAGE_SIZE, (off_t)pid * PAGE_SIZE) < 0) return RC_FILE_WRITE_FAILED;
 
   // if the page is in read cache, invalidate it
+  pthread_mutex_lock(&cacheLock);
+  writeClock++;
   for (int i = 0; i < CACHE_COUNT; i++) {
     if (readCache[i].fd == fd && readCache[i].pid == pid &&
         readCache[i].lastAccessed != 0) {
@@ -119,36 +177,65 @@ RC PageFile::write(PageId pid, const void* buffer)
        break;
     }
   }
+  pthread_mutex_unlock(&cacheLock);
 
   // if the written pid >= end pid, update the end pid
   if (pid >= epid) epid = pid + 1;
 
   // increase page write count
-  writeCount++;
+  __sync_fetch_and_add(&writeCount, 1);
 
   return 0;
 }
 
 RC PageFile::read(PageId pid, void* buffer) const
 {
-  RC rc;
-
   if (pid < 0 || pid >= epid) return RC_INVALID_PID; 
 
   //
   // if the page is in cache, read it from there
   //
+  pthread_mutex_lock(&cacheLock);
   for (int i = 0; i < CACHE_COUNT; i++) {
     if (readCache[i].fd == fd && readCache[i].pid == pid && 
         readCache[i].lastAccessed != 0) {
        memcpy(buffer, readCache[i].buffer, PAGE_SIZE);
        readCache[i].lastAccessed = ++cacheClock;
+       pthread_mutex_unlock(&cacheLock);
        return 0;
     }
   }
+  unsigned clock = writeClock;
+  pthread_mutex_unlock(&cacheLock);
+
+  // read the page without holding the lock, so that the threads that
+  // miss the cache wait for the disk in parallel (and decode it in parallel)
+  if (codec != NULL) {
+    RC rc = readBlock(pid, buffer);
+    if (rc < 0) return rc;
+  } else if (::pread(fd, buffer, PAGE_SIZE, (off_t)pid * PAGE_SIZE) < 0) {
+    return RC_FILE_READ_FAILED;
+  }
+
+  // increase the page read count
+  __sync_fetch_and_add(&readCount, 1);
 
-  // seek to the page
-  if ((rc = seek(pid) < 0)) return rc;
+  pthread_mutex_lock(&cacheLock);
+
+  // a page that may have been written meanwhile is not cached
+  if (clock != writeClock) {
+    pthread_mutex_unlock(&cacheLock);
+    return 0;
+  }
+
+  // another thread may have cached the page meanwhile
+  for (int i = 0; i < CACHE_COUNT; i++) {
+    if (readCache[i].fd == fd && readCache[i].pid == pid &&
+        readCache[i].lastAccessed != 0) {
+      pthread_mutex_unlock(&cacheLock);
+      return 0;
+    }
+  }
   
   // find the cache slot to evict
   int toEvict = 0; 
@@ -164,15 +251,131 @@ RC PageFile::read(PageId pid, void* buffer) const
   readCache[toEvict].fd = fd;
   readCache[toEvict].pid = pid;
   readCache[toEvict].lastAccessed = ++cacheClock;
- 
-  // read the page to cache first and copy it to the buffer
-  if (::read(fd, readCache[toEvict].buffer, PAGE_SIZE) < 0) {
+  memcpy(readCache[toEvict].buffer, buffer, PAGE_SIZE);
+
+  pthread_mutex_unlock(&cacheLock);
+  return 0;
+}
+
+RC PageFile::readDirect(PageId pid, void* buffer) const
+{
+  if (pid < 0 || pid >= epid) return RC_INVALID_PID; 
+
+  // pread does not move the shared file cursor
+  if (codec != NULL) {
+    RC rc = readBlock(pid, buffer);
+    if (rc < 0) return rc;
+  } else if (::pread(fd, buffer, PAGE_SIZE, (off_t)pid * PAGE_SIZE) < 0) {
     return RC_FILE_READ_FAILED;
   }
-  memcpy(buffer, readCache[toEvict].buffer, PAGE_SIZE);
 
   // increase the page read count
-  readCount++;
+  __sync_fetch_and_add(&readCount, 1);
+  return 0;
+}
+
+RC PageFile::readDirectory()
+{
+  // the offset of the directory is after the magic bytes, and the
+  // directory starts with the # pages
+  off_t directory;
+  int   count;
+  if (dataEnd < FIRST_BLOCK + (off_t)sizeof(count) ||
+      ::pread(fd, &directory, sizeof(directory), DIRECTORY_POINTER) != (ssize_t)sizeof(directory) ||
+      directory < FIRST_BLOCK || directory > dataEnd - (off_t)sizeof(count) ||
+      ::pread(fd, &count, sizeof(count), directory) != (ssize_t)sizeof(count) ||
+      count < 0 ||
+      count > (dataEnd - directory - (off_t)sizeof(count)) / (off_t)(sizeof(off_t) + sizeof(unsigned)))
+    return RC_INVALID_FILE_FORMAT;
+
+  offsets.resize(count);
+  lengths.resize(count);
+  off_t  pos = directory + sizeof(count);
+  size_t size = count * sizeof(off_t);
+  if (count > 0 &&
+      (::pread(fd, &offsets[0], size, pos) != (ssize_t)size ||
+       ::pread(fd, &lengths[0], count * sizeof(unsigned), pos + size) != (ssize_t)(count * sizeof(unsigned))))
+    return RC_FILE_READ_FAILED;
+  for (int i = 0; i < count; i++) {
+    if (offsets[i] < FIRST_BLOCK || lengths[i] > (unsigned)MAX_BLOCK_SIZE ||
+        offsets[i] > directory - (off_t)lengths[i])
+      return RC_INVALID_FILE_FORMAT;
+  }
+
+  // new blocks go after everything in the file, so that the directory
+  // on disk stays as it is until the next one is written
+  directoryEnd = dataEnd;
+  epid = count;
+  directoryDirty = false;
+  return 0;
+}
+
+RC PageFile::writeDirectory()
+{
+  int count = offsets.size();
+  vector<char> directory(sizeof(count) + count * (sizeof(off_t) + sizeof(unsigned)));
+  memcpy(&directory[0], &count, sizeof(count));
+  if (count > 0) {
+    memcpy(&directory[sizeof(count)], &offsets[0], count * sizeof(off_t));
+    memcpy(&directory[sizeof(count) + count * sizeof(off_t)], &lengths[0], count * sizeof(unsigned));
+  }
+
+  // the new directory goes after the blocks and is on the disk before
+  // the file points to it. the file ends after the directory
+  off_t pos = dataEnd;
+  if (::pwrite(fd, &directory[0], directory.size(), pos) != (ssize_t)directory.size() ||
+      ::fdatasync(fd) < 0 ||
+      ::pwrite(fd, &pos, sizeof(pos), DIRECTORY_POINTER) != (ssize_t)sizeof(pos) ||
+      ::ftruncate(fd, pos + directory.size()) < 0)
+    return RC_FILE_WRITE_FAILED;
+  dataEnd = directoryEnd = pos + directory.size();
+  directoryDirty = false;
+  return 0;
+}
+
+RC PageFile::readBlock(PageId pid, void* buffer) const
+{
+  char block[MAX_BLOCK_SIZE];
+  if (::pread(fd, block, lengths[pid], offsets[pid]) != (ssize_t)lengths[pid])
+    return RC_FILE_READ_FAILED;
+  if (!codec->decode(block, lengths[pid], (char*)buffer))
+    return RC_INVALID_FILE_FORMAT;
+  return 0;
+}
 
+RC PageFile::writeBlock(PageId pid, const void* buffer)
+{
+  RC   rc;
+  char block[MAX_BLOCK_SIZE];
+
+  // the pages that are skipped are written empty
+  if (pid > (PageId)offsets.size()) {
+    char empty[PAGE_SIZE];
+    memset(empty, 0, PAGE_SIZE);
+    while (pid > (PageId)offsets.size()) {
+      if ((rc = writeBlock(offsets.size(), empty)) < 0) return rc;
+    }
+  }
+
+  int length = codec->encode((const char*)buffer, block);
+
+  // the last block of the file is overwritten in place if the directory
+  // on disk does not refer to it; any other page (or a new one) gets a
+  // block at the end
+  off_t offset = dataEnd;
+  if (pid < (PageId)offsets.size() && offsets[pid] >= directoryEnd &&
+      offsets[pid] + lengths[pid] == dataEnd)
+    offset = offsets[pid];
+  if (::pwrite(fd, block, length, offset) != (ssize_t)length) return RC_FILE_WRITE_FAILED;
+
+  if (pid == (PageId)offsets.size()) {
+    offsets.push_back(offset);
+    lengths.push_back(length);
+  } else {
+    offsets[pid] = offset;
+    lengths[pid] = length;
+  }
+  dataEnd = offset + length;
+  directoryDirty = true;
   return 0;
 }
@@ -11,18 +11,54 @@
 #define PAGEFILE_H
 
 #include <string>
+#include <vector>
+#include <sys/types.h>
 #include "Bruinbase.h"
 
 typedef int PageId;
 
+/**
+ * the functions that turn a page into a shorter block and back, for a
+ * PageFile whose pages are stored compressed
+ */
+typedef struct {
+  // encode a page into block (at most PageFile::MAX_BLOCK_SIZE bytes).
+  // returns the # bytes of the block
+  int  (*encode)(const char* page, char* block);
+  // decode a block of length bytes into page. returns false if the
+  // block is not well-formed
+  bool (*decode)(const char* block, int length, char* page);
+} PageCodec;
+
 /**
  * read/write a file in the unit of a page
+ *
+ * the pages of a file may also be stored compressed: a compressed file
+ * starts with the bytes of COMPRESSED_MAGIC and the 64-bit offset of its
+ * directory, followed by the pages encoded into blocks of different
+ * lengths, and ends with the directory of the blocks (the # pages, then
+ * the 64-bit offsets and the 32-bit lengths of the blocks of the pages).
+ * the directory is kept in memory while the file is open and written
+ * back when it is closed: the new directory goes after the blocks, and
+ * only then is the offset at the start of the file changed to point to
+ * it. the blocks and the directory that are on disk are never written
+ * over, so that if the file is not closed, it keeps the pages it had
+ * when it was last closed. a page that is written again is encoded
+ * again: the last block of the file is overwritten if it was written
+ * after the directory, and any other block is moved to the end of the
+ * file. the page cache holds the decoded pages.
  */
 class PageFile {
  public:
 
   static const int PAGE_SIZE = 1024;    // the size of a page is 1KB
 
+  // the most bytes of a block of a compressed file
+  static const int MAX_BLOCK_SIZE = 2 * PAGE_SIZE;
+
+  // the first bytes of a compressed file
+  static const char COMPRESSED_MAGIC[8];
+
   PageFile();
   PageFile(const std::string& filename, char mode);
 
@@ -31,9 +67,12 @@ class PageFile {
    * when opened in 'w' mode, if the file does not exist, it is created.
    * @param filename[IN] the name of the file to open
    * @param mode[IN] 'r' for read, 'w' for write
+   * @param codec[IN] the codec of the pages if the file is compressed
+   * (NULL if the file cannot be a compressed one)
+   * @param compress[IN] true if a new (empty) file is created compressed
    * @return error code. 0 if no error
    */
-  RC open(const std::string& filename, char mode);
+  RC open(const std::string& filename, char mode, const PageCodec* codec = NULL, bool compress = false);
 
   /**
    * close the file.
@@ -43,11 +82,24 @@ class PageFile {
   
   /**
    * read a disk page into memory buffer.
+   * the page cache is shared by all PageFiles and is safe to use from
+   * several threads at once, but a PageFile must not be written by one
+   * thread while it is read by others.
    * @param pid[IN] the page to read
    * @param buffer[OUT] pointer to memory buffer
    * @return error code. 0 if no error
    */
   RC read(PageId pid, void *buffer) const;
+
+  /**
+   * read a disk page into memory buffer, bypassing the page cache.
+   * it is meant for scans that read every page once, which would only
+   * evict the useful pages from the small cache.
+   * @param pid[IN] the page to read
+   * @param buffer[OUT] pointer to memory buffer
+   * @return error code. 0 if no error
+   */
+  RC readDirect(PageId pid, void *buffer) const;
   
   /**
    * write the memory buffer to the disk page.
@@ -66,6 +118,11 @@ class PageFile {
    */
   PageId endPid() const;
 
+  /**
+   * @return true if the pages of the file are stored compressed
+   */
+  bool isCompressed() const { return codec != NULL; }
+
   /**
    * @return the total # of disk reads
    */
@@ -89,6 +146,33 @@ class PageFile {
   int     fd;     // file descriptor of the associated unix file
   PageId  epid;   // (last page id + 1) of the file
 
+  //
+  // the state of a compressed file
+  //
+  const PageCodec*      codec;     // the codec of the pages (NULL if not compressed)
+  std::vector<off_t>    offsets;   // the offset of the block of every page
+  std::vector<unsigned> lengths;   // the length of the block of every page
+  off_t                 dataEnd;   // the end of the last block
+  off_t                 directoryEnd;   // the end of the directory on disk
+  bool                  directoryDirty; // true if the directory on disk is out of date
+
+  // the offset of the offset of the directory of a compressed file, and
+  // the offset of its first block
+  static const off_t DIRECTORY_POINTER = sizeof(COMPRESSED_MAGIC);
+  static const off_t FIRST_BLOCK = DIRECTORY_POINTER + sizeof(off_t);
+
+  // read the directory of a compressed file
+  RC readDirectory();
+
+  // write the directory of a compressed file at the end of the blocks
+  RC writeDirectory();
+
+  // read and decode the block of a page of a compressed file
+  RC readBlock(PageId pid, void* buffer) const;
+
+  // encode a page and write its block to a compressed file
+  RC writeBlock(PageId pid, const void* buffer);
+
   //
   // the following set of members implement LRU caching 
   //
@@ -7,8 +7,10 @@
  * @date 3/24/2008
  */
 
+#include <cstring>
 #include "Bruinbase.h"
 #include "RecordFile.h"
+#include "LZCodec.h"
 
 using std::string;
 
@@ -23,7 +25,7 @@ static char* slotPtr(char* page, int n);
 static void readSlot(const char* page, int n, int& key, std::string& value);
 
 // write the record to the n'th slot in the page
-static void writeSlot(char* page, int n, int key, const std::string& value);
+static void writeSlot(char* page, int n, int key, const char* value, int length);
 
 // get # records stored in the page
 static int getRecordCount(const char* page);
@@ -31,6 +33,49 @@ static int getRecordCount(const char* page);
 // update # records stored in the page
 static void setRecordCount(char* page, int count);
 
+// encode a page into a block of a compressed file and back
+static int encodePage(const char* page, char* block);
+static bool decodePage(const char* block, int length, char* page);
+
+static const PageCodec recordCodec = { encodePage, decodePage };
+
+//
+// the pages of a columnar file
+//
+
+// the most value pages of a zone: a value takes at most
+// MAX_VALUE_LENGTH bytes with its length, so at least ten fit in a page
+static const int MAX_VALUE_PAGES = 32;
+
+// a key page of a columnar file: the keys of a zone and where its
+// values are. the values of a zone start on a page of their own.
+typedef struct {
+  int count;           // # keys in the page
+  int firstValuePage;  // the first value page of the zone
+  int valuePages;      // # value pages of the zone
+  unsigned char valueStarts[MAX_VALUE_PAGES];  // the first record of every value page
+  int keys[RecordFile::KEYS_PER_ZONE];
+} KeyPage;
+
+// a value page of a columnar file: the values, each a length byte
+// followed by the value
+typedef struct {
+  int  count;  // # values in the page
+  int  used;   // # bytes of data used
+  char data[PageFile::PAGE_SIZE - 2 * sizeof(int)];
+} ValuePage;
+
+// the first page of a columnar file
+static const char COLUMNAR_MAGIC[8] = { '\x89', 'B', 'R', 'C', '\r', '\n', '\x1a', '\n' };
+
+// the name of a file that goes with a columnar file: its name with the
+// suffix in place of ".tbl"
+static string columnFileName(const string& filename, const char* suffix);
+
+// read the values of a value page from the n'th on (at most max of them).
+// returns # values read (-1 if the page is not well-formed)
+static int readValues(const char* page, int n, string values[], int max);
+
 
 //
 // helper functions for RecordId manipulation
@@ -106,20 +151,44 @@ RecordFile::RecordFile()
 {
   erid.pid = 0;
   erid.sid = 0;
+  tailPid = -1;
+  tailDirty = false;
+  columnar = false;
+  rowCount = 0;
+  valueTailPid = -1;
+  valueTailDirty = false;
 }
 
 RecordFile::RecordFile(const string& filename, char mode)
 {
+  tailPid = -1;
+  tailDirty = false;
+  columnar = false;
+  rowCount = 0;
+  valueTailPid = -1;
+  valueTailDirty = false;
   open(filename, mode);
 }
 
-RC RecordFile::open(const string& filename, char mode)
+RC RecordFile::open(const string& filename, char mode, Storage storage)
 {
   RC   rc;
   char page[PageFile::PAGE_SIZE];
 
   // open the page file
-  if ((rc = pf.open(filename, mode)) < 0) return rc;
+  columnar = false;
+  if ((rc = pf.open(filename, mode, &recordCodec, storage == COMPRESSED)) < 0) return rc;
+
+  // a columnar file starts with a header page
+  if (pf.endPid() == 0) {
+    if (storage == COLUMNAR && mode == 'w') return openColumns(filename, mode);
+  } else {
+    if ((rc = pf.read(0, page)) < 0) {
+      pf.close();
+      return rc;
+    }
+    if (memcmp(page, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) == 0) return openColumns(filename, mode);
+  }
   
   //
   // in the rest of this function, we set the end record id
@@ -132,6 +201,7 @@ RC RecordFile::open(const string& filename, char mode)
   // set the end record id to (0, 0).
   if (erid.pid == 0) {
     erid.sid = 0;
+    openZoneMap(filename, mode);
     return 0;
   }
 
@@ -152,16 +222,120 @@ RC RecordFile::open(const string& filename, char mode)
     erid.pid++;
     erid.sid = 0;
   }
-  
+
+  openZoneMap(filename, mode);
+  return 0;
+}
+
+void RecordFile::openZoneMap(const string& filename, char mode)
+{
+  string::size_type n = filename.size();
+  int perZone = columnar ? KEYS_PER_ZONE : RECORDS_PER_PAGE;
+  int records = erid.pid * RECORDS_PER_PAGE + erid.sid;
+
+  // only tables have a zone map. without it, no zone is summarized
+  if (n < 4 || filename.compare(n - 4, 4, ".tbl") != 0) return;
+  if (zones.open(columnFileName(filename, ".zm"), mode) < 0) return;
+
+  // a zone that records were added to without the zone map (or a zone
+  // map that is newer than the file) is not to be trusted: the zones
+  // that summarize all of their records are kept
+  if (zones.getTupleCount() != records) {
+    int kept = (zones.getTupleCount() < records ? zones.getTupleCount() : records) / perZone;
+    zones.truncate(kept, kept * perZone);
+  }
+  if (mode != 'w') return;
+
+  // summarize the zones that the zone map is missing
+  int    count;
+  int    keys[MAX_ZONE_RECORDS];
+  string values[MAX_ZONE_RECORDS];
+  for (int zone = zones.getZoneCount(); zone < getZoneCount(); zone++) {
+    if (readZone(zone, count, keys, values) < 0) {
+      zones.close();
+      return;
+    }
+    for (int i = 0; i < count; i++)
+      zones.add(zone, keys[i], values[i].data(), values[i].size());
+  }
+}
+
+RC RecordFile::openColumns(const string& filename, char mode)
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+
+  columnar = true;
+  rowCount = 0;
+
+  // a new file gets its header page
+  if (pf.endPid() == 0) {
+    memset(page, 0, PageFile::PAGE_SIZE);
+    memcpy(page, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+    if ((rc = pf.write(0, page)) < 0) goto exit_open;
+  }
+  if ((rc = valuePf.open(columnFileName(filename, ".val"), mode)) < 0) goto exit_open;
+
+  // every key page but the last is full
+  if (pf.endPid() > 1) {
+    if ((rc = pf.read(pf.endPid() - 1, page)) < 0) goto exit_open;
+    const KeyPage* kp = (const KeyPage*)page;
+    if (kp->count < 1 || kp->count > KEYS_PER_ZONE) {
+      rc = RC_INVALID_FILE_FORMAT;
+      goto exit_open;
+    }
+    rowCount = (pf.endPid() - 2) * KEYS_PER_ZONE + kp->count;
+  }
+  erid.pid = rowCount / RECORDS_PER_PAGE;
+  erid.sid = rowCount % RECORDS_PER_PAGE;
+  openZoneMap(filename, mode);
   return 0;
+
+  exit_open:
+  columnar = false;
+  rowCount = 0;
+  valuePf.close();
+  pf.close();
+  return rc;
 }
 
 RC RecordFile::close()
 {
+  RC rc = flush();
+  RC closed;
+
   erid.pid = 0;
   erid.sid = 0;
+  tailPid = -1;
+  tailDirty = false;
+
+  if ((closed = zones.close()) < 0 && rc == 0) rc = closed;
+  if (columnar) {
+    if ((closed = valuePf.close()) < 0 && rc == 0) rc = closed;
+    columnar = false;
+    rowCount = 0;
+    valueTailPid = -1;
+  }
 
-  return pf.close();
+  closed = pf.close();
+  return (rc < 0) ? rc : closed;
+}
+
+RC RecordFile::flush()
+{
+  RC rc;
+
+  // the values go first, so that a key page never refers to a value
+  // page that is not written
+  if (valueTailDirty) {
+    if ((rc = valuePf.write(valueTailPid, valueTail)) < 0) return rc;
+    valueTailDirty = false;
+  }
+
+  if (!tailDirty) return 0;
+  if ((rc = pf.write(tailPid, tail)) < 0) return rc;
+  tailDirty = false;
+  return 0;
 }
 
 RC RecordFile::read(const RecordId& rid, int& key, string& value) const
@@ -173,7 +347,15 @@ RC RecordFile::read(const RecordId& rid, int& key, string& value) const
   if (rid.pid < 0 || rid.pid > erid.pid) return RC_INVALID_RID;
   if (rid.sid < 0 || rid.sid >= RecordFile::RECORDS_PER_PAGE) return RC_INVALID_RID;
   if (rid >= erid) return RC_INVALID_RID;
+
+  if (columnar) return readColumns(rid.pid * RECORDS_PER_PAGE + rid.sid, key, value);
   
+  // the last page may have records that are not written yet
+  if (tailDirty && rid.pid == tailPid) {
+    readSlot(tail, rid.sid, key, value);
+    return 0;
+  }
+
   // read the page containing the record
   if ((rc = pf.read(rid.pid, page)) < 0) return rc;
 
@@ -183,30 +365,232 @@ RC RecordFile::read(const RecordId& rid, int& key, string& value) const
   return 0;
 }
 
-RC RecordFile::append(int key, const std::string& value, RecordId& rid)
+RC RecordFile::readPage(PageId pid, int& count, int keys[], string values[]) const
 {
   RC   rc;
   char page[PageFile::PAGE_SIZE];
 
+  // check whether the pid is in the valid range
+  if (pid < 0 || pid > erid.pid || (pid == erid.pid && erid.sid == 0)) return RC_INVALID_PID;
+
+  // the records of a columnar file are gathered from its key and value pages
+  if (columnar) {
+    count = 0;
+    for (int row = pid * RECORDS_PER_PAGE; row < rowCount && count < RECORDS_PER_PAGE; row++, count++) {
+      if ((rc = readColumns(row, keys[count], values[count])) < 0) return rc;
+    }
+    return 0;
+  }
+
+  // the last page may have records that are not written yet
+  const char* p = page;
+  if (tailDirty && pid == tailPid) {
+    p = tail;
+  } else if ((rc = pf.readDirect(pid, page)) < 0) {
+    return rc;
+  }
+
+  // read every record in the page
+  count = getRecordCount(p);
+  if (count > RECORDS_PER_PAGE) return RC_INVALID_FILE_FORMAT;
+  for (int i = 0; i < count; i++) {
+    readSlot(p, i, keys[i], values[i]);
+  }
+
+  return 0;
+}
+
+int RecordFile::getZoneCount() const
+{
+  if (columnar) return (rowCount + KEYS_PER_ZONE - 1) / KEYS_PER_ZONE;
+  return erid.pid + (erid.sid > 0 ? 1 : 0);
+}
+
+RC RecordFile::readZone(int zone, int& count, int keys[], string values[]) const
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+  char valuePage[PageFile::PAGE_SIZE];
+
+  if (!columnar) return readPage(zone, count, keys, values);
+
+  if (zone < 0 || zone >= getZoneCount()) return RC_INVALID_PID;
+  if ((rc = readKeyPage(zone, page, true)) < 0) return rc;
+  const KeyPage* kp = (const KeyPage*)page;
+  count = kp->count;
+  if (count < 0 || count > KEYS_PER_ZONE) return RC_INVALID_FILE_FORMAT;
+  memcpy(keys, kp->keys, count * sizeof(int));
+
+  // the values of the zone are on consecutive value pages
+  int n = 0;
+  for (int i = 0; i < kp->valuePages && i < MAX_VALUE_PAGES; i++) {
+    if ((rc = readValuePage(kp->firstValuePage + i, valuePage, true)) < 0) return rc;
+    int read = readValues(valuePage, 0, values + n, count - n);
+    if (read < 0) return RC_INVALID_FILE_FORMAT;
+    n += read;
+  }
+  return (n == count) ? 0 : RC_INVALID_FILE_FORMAT;
+}
+
+RC RecordFile::readZoneKeys(int zone, int& count, int keys[]) const
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+
+  if (!columnar) {
+    string values[RECORDS_PER_PAGE];
+    return readPage(zone, count, keys, values);
+  }
+
+  if (zone < 0 || zone >= getZoneCount()) return RC_INVALID_PID;
+  if ((rc = readKeyPage(zone, page, true)) < 0) return rc;
+  const KeyPage* kp = (const KeyPage*)page;
+  count = kp->count;
+  if (count < 0 || count > KEYS_PER_ZONE) return RC_INVALID_FILE_FORMAT;
+  memcpy(keys, kp->keys, count * sizeof(int));
+  return 0;
+}
+
+RC RecordFile::readKeyPage(int zone, char* page, bool direct) const
+{
+  // the key page of zone z is page z+1, after the header
+  if (tailDirty && tailPid == zone + 1) {
+    memcpy(page, tail, PageFile::PAGE_SIZE);
+    return 0;
+  }
+  return direct ? pf.readDirect(zone + 1, page) : pf.read(zone + 1, page);
+}
+
+RC RecordFile::readValuePage(PageId pid, char* page, bool direct) const
+{
+  if (valueTailDirty && valueTailPid == pid) {
+    memcpy(page, valueTail, PageFile::PAGE_SIZE);
+    return 0;
+  }
+  return direct ? valuePf.readDirect(pid, page) : valuePf.read(pid, page);
+}
+
+RC RecordFile::readColumns(int row, int& key, string& value) const
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+  int  zone = row / KEYS_PER_ZONE;
+  int  n = row % KEYS_PER_ZONE;
+
+  if ((rc = readKeyPage(zone, page, false)) < 0) return rc;
+  const KeyPage* kp = (const KeyPage*)page;
+  if (n >= kp->count || kp->valuePages < 1 || kp->valuePages > MAX_VALUE_PAGES)
+    return RC_INVALID_FILE_FORMAT;
+  key = kp->keys[n];
+
+  // find the value page that the record starts on
+  int i = kp->valuePages - 1;
+  while (i > 0 && kp->valueStarts[i] > n) i--;
+  int skip = n - kp->valueStarts[i];
+  if ((rc = readValuePage(kp->firstValuePage + i, page, false)) < 0) return rc;
+  return (readValues(page, skip, &value, 1) == 1) ? 0 : RC_INVALID_FILE_FORMAT;
+}
+
+RC RecordFile::appendColumns(int key, const char* value, int length, RecordId& rid)
+{
+  RC  rc;
+  int zone = rowCount / KEYS_PER_ZONE;
+  int n = rowCount % KEYS_PER_ZONE;
+  KeyPage*   kp = (KeyPage*)tail;
+  ValuePage* vp = (ValuePage*)valueTail;
+
+  // the value is stored as writeSlot() stores it: up to its first null
+  // character and at most MAX_VALUE_LENGTH-1 bytes
+  if (length > MAX_VALUE_LENGTH - 1) length = MAX_VALUE_LENGTH - 1;
+  length = strnlen(value, length);
+
+  // the key page of the zone and its last value page are kept in memory
+  // while records are appended to them
+  if (tailPid != zone + 1) {
+    if (n > 0) {
+      if ((rc = pf.read(zone + 1, tail)) < 0) return rc;
+      valueTailPid = kp->firstValuePage + kp->valuePages - 1;
+      if ((rc = valuePf.read(valueTailPid, valueTail)) < 0) return rc;
+    } else {
+      // the values of a new zone start on a new value page
+      memset(tail, 0, PageFile::PAGE_SIZE);
+      memset(valueTail, 0, PageFile::PAGE_SIZE);
+      kp->firstValuePage = valuePf.endPid();
+      kp->valuePages = 1;
+      valueTailPid = kp->firstValuePage;
+    }
+    tailPid = zone + 1;
+  }
+
+  // move on to the next value page when the value does not fit
+  if (vp->used + 1 + length > (int)sizeof(vp->data)) {
+    if (kp->valuePages >= MAX_VALUE_PAGES) return RC_INVALID_FILE_FORMAT;
+    if ((rc = valuePf.write(valueTailPid, valueTail)) < 0) return rc;
+    valueTailDirty = false;
+    kp->valueStarts[kp->valuePages++] = n;
+    valueTailPid++;
+    memset(valueTail, 0, PageFile::PAGE_SIZE);
+  }
+
+  vp->data[vp->used] = (char)length;
+  memcpy(vp->data + vp->used + 1, value, length);
+  vp->used += 1 + length;
+  vp->count++;
+  kp->keys[n] = key;
+  kp->count = n + 1;
+  tailDirty = valueTailDirty = true;
+
+  // a zone map that misses a zone (it was lost) is not extended, so that
+  // no zone is summarized by part of its records
+  if (zone < zones.getZoneCount() || (zone == zones.getZoneCount() && n == 0))
+    zones.add(zone, key, value, length);
+
+  rid = erid;
+  ++erid;
+  rowCount++;
+
+  // write the pages to the disk once the zone is full
+  if (n + 1 == KEYS_PER_ZONE) return flush();
+
+  return 0;
+}
+
+RC RecordFile::append(int key, const std::string& value, RecordId& rid)
+{
+  return append(key, value.data(), value.size(), rid);
+}
+
+RC RecordFile::append(int key, const char* value, int length, RecordId& rid)
+{
+  RC rc;
+
+  if (columnar) return appendColumns(key, value, length, rid);
+
+  // the last page is kept in memory while records are appended to it.
   // unless we are writing to the the first slot of an empty page,
   // we have to read the page first
-  if (erid.sid > 0) {
-    if ((rc = pf.read(erid.pid, page)) < 0) return rc;
-  } else {
-    // if this is the first slot of an empty page
-    // we can simply initialize the page with zeros
-    memset(page, 0, PageFile::PAGE_SIZE);
+  if (tailPid != erid.pid) {
+    if (erid.sid > 0) {
+      if ((rc = pf.read(erid.pid, tail)) < 0) return rc;
+    } else {
+      // if this is the first slot of an empty page
+      // we can simply initialize the page with zeros
+      memset(tail, 0, PageFile::PAGE_SIZE);
+    }
+    tailPid = erid.pid;
   }
     
   // write the record to the first empty slot 
-  writeSlot(page, erid.sid, key, value);
+  writeSlot(tail, erid.sid, key, value, length);
 
   // the first four bytes in the page stores # records in the page.
   // update this number.
-  setRecordCount(page, erid.sid + 1);
+  setRecordCount(tail, erid.sid + 1);
+  tailDirty = true;
 
-  // write the page to the disk
-  if ((rc = pf.write(erid.pid, page)) < 0) return rc;
+  // the zone of a record is its page
+  if (erid.pid < zones.getZoneCount() || (erid.pid == zones.getZoneCount() && erid.sid == 0))
+    zones.add(erid.pid, key, value, length);
     
   // we need to output the rid of the record slot
   rid = erid;
@@ -214,6 +598,21 @@ RC RecordFile::append(int key, const std::string& value, RecordId& rid)
   // advance the end record id by one to the next empty slot
   ++erid;
 
+  // write the page to the disk once it is full
+  if (erid.pid != tailPid) return flush();
+
+  return 0;
+}
+
+RC RecordFile::appendBatch(const RecordRef* records, int count, RecordId& first)
+{
+  RC       rc;
+  RecordId rid;
+
+  first = erid;
+  for (int i = 0; i < count; i++) {
+    if ((rc = append(records[i].key, records[i].value, records[i].length, rid)) < 0) return rc;
+  }
   return 0;
 }
 
@@ -258,7 +657,7 @@ static void readSlot(const char* page, int n, int& key, std::string& value)
   value.assign(ptr + sizeof(int));
 }
 
-static void writeSlot(char* page, int n, int key, const std::string& value)
+static void writeSlot(char* page, int n, int key, const char* value, int length)
 {
   // compute the location of the record
   char *ptr = slotPtr(page, n);
@@ -267,11 +666,137 @@ static void writeSlot(char* page, int n, int key, const std::string& value)
   memcpy(ptr, &key, sizeof(int));
 
   // store the value. 
-  if ((int)value.size() >= RecordFile::MAX_VALUE_LENGTH) {
+  if (length >= RecordFile::MAX_VALUE_LENGTH) {
     // when the string is longer than MAX_VALUE_LENGTH, truncate it.
-    memcpy(ptr + sizeof(int), value.c_str(), RecordFile::MAX_VALUE_LENGTH -1);
+    memcpy(ptr + sizeof(int), value, RecordFile::MAX_VALUE_LENGTH -1);
     *(ptr + sizeof(int) + RecordFile::MAX_VALUE_LENGTH - 1) = 0;
   } else {
-    strcpy(ptr + sizeof(int), value.c_str());
+    memcpy(ptr + sizeof(int), value, length);
+    *(ptr + sizeof(int) + length) = 0;
+  }
+}
+
+static string columnFileName(const string& filename, const char* suffix)
+{
+  string::size_type n = filename.size();
+  if (n >= 4 && filename.compare(n - 4, 4, ".tbl") == 0)
+    return filename.substr(0, n - 4) + suffix;
+  return filename + suffix;
+}
+
+static int readValues(const char* page, int n, string values[], int max)
+{
+  const ValuePage* vp = (const ValuePage*)page;
+  if (vp->count < 0 || vp->used < 0 || vp->used > (int)sizeof(vp->data)) return -1;
+
+  const unsigned char* p = (const unsigned char*)vp->data;
+  const unsigned char* end = p + vp->used;
+  int read = 0;
+  for (int i = 0; i < vp->count && read < max; i++) {
+    if (p >= end || end - p - 1 < *p) return -1;
+    if (i >= n) values[read++].assign((const char*)p + 1, *p);
+    p += 1 + *p;
+  }
+  return read;
+}
+
+// the block of a compressed page starts with the way it is encoded
+static const char BLOCK_PLAIN = 0;       // the page as it is
+static const char BLOCK_DICTIONARY = 1;  // the dictionary form, compressed
+
+// the dictionary form of a page is
+//   # records (a byte), the keys, the dictionary code of every value
+//   (a byte each), # values in the dictionary (a byte), and the values
+//   of the dictionary, each a length byte followed by the value
+static int encodePage(const char* page, char* block)
+{
+  char  form[PageFile::PAGE_SIZE];
+  const char* values[RecordFile::RECORDS_PER_PAGE];
+  int   lengths[RecordFile::RECORDS_PER_PAGE];
+  int   count = getRecordCount(page);
+
+  // a page that is not a record page is kept as it is
+  if (count < 0 || count > RecordFile::RECORDS_PER_PAGE) {
+    block[0] = BLOCK_PLAIN;
+    memcpy(block + 1, page, PageFile::PAGE_SIZE);
+    return PageFile::PAGE_SIZE + 1;
+  }
+
+  char* p = form;
+  *p++ = (char)count;
+  for (int i = 0; i < count; i++) {
+    memcpy(p, slotPtr(const_cast<char*>(page), i), sizeof(int));
+    p += sizeof(int);
+  }
+
+  // every value gets the code of the first record with the same value
+  char* codes = p;
+  int   distinct = 0;
+  p += count;
+  for (int i = 0; i < count; i++) {
+    const char* value = slotPtr(const_cast<char*>(page), i) + sizeof(int);
+    int length = strnlen(value, RecordFile::MAX_VALUE_LENGTH - 1);
+    int code = 0;
+    while (code < distinct && (lengths[code] != length || memcmp(values[code], value, length) != 0))
+      code++;
+    if (code == distinct) {
+      values[distinct] = value;
+      lengths[distinct++] = length;
+    }
+    codes[i] = (char)code;
+  }
+  *p++ = (char)distinct;
+  for (int i = 0; i < distinct; i++) {
+    *p++ = (char)lengths[i];
+    memcpy(p, values[i], lengths[i]);
+    p += lengths[i];
+  }
+
+  block[0] = BLOCK_DICTIONARY;
+  return LZCodec::compress(form, p - form, block + 1) + 1;
+}
+
+static bool decodePage(const char* block, int length, char* page)
+{
+  char form[PageFile::PAGE_SIZE];
+
+  if (length < 1) return false;
+  if (block[0] == BLOCK_PLAIN) {
+    if (length != PageFile::PAGE_SIZE + 1) return false;
+    memcpy(page, block + 1, PageFile::PAGE_SIZE);
+    return true;
+  }
+
+  int size = LZCodec::decompress(block + 1, length - 1, form, sizeof(form));
+  if (block[0] != BLOCK_DICTIONARY || size < 2) return false;
+
+  const unsigned char* p = (const unsigned char*)form;
+  const unsigned char* end = p + size;
+  int count = *p++;
+  if (count > RecordFile::RECORDS_PER_PAGE || end - p < (int)(sizeof(int) + 1) * count + 1) return false;
+  const unsigned char* keys = p;
+  const unsigned char* codes = p + sizeof(int) * count;
+  p = codes + count;
+
+  // find the values of the dictionary
+  const char* values[RecordFile::RECORDS_PER_PAGE];
+  int lengths[RecordFile::RECORDS_PER_PAGE];
+  int distinct = *p++;
+  if (distinct > count) return false;
+  for (int i = 0; i < distinct; i++) {
+    if (p >= end || *p >= RecordFile::MAX_VALUE_LENGTH || end - p - 1 < *p) return false;
+    lengths[i] = *p++;
+    values[i] = (const char*)p;
+    p += lengths[i];
+  }
+
+  memset(page, 0, PageFile::PAGE_SIZE);
+  setRecordCount(page, count);
+  for (int i = 0; i < count; i++) {
+    int key;
+    if (codes[i] >= distinct) return false;
+    memcpy(&key, keys + sizeof(int) * i, sizeof(int));
+    writeSlot(page, i, key, values[codes[i]], lengths[codes[i]]);
   }
+  return true;
 }
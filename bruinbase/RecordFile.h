@@ -12,6 +12,7 @@
 
 #include <string>
 #include "PageFile.h"
+#include "ZoneMap.h"
 
 /**
  * The data structure for pointing to a particular record in a RecordFile.
@@ -38,6 +39,16 @@ bool operator<= (const RecordId& r1, const RecordId& r2);
 bool operator== (const RecordId& r1, const RecordId& r2);
 bool operator!= (const RecordId& r1, const RecordId& r2);
 
+/**
+ * a record whose value is given as a character array that does not have
+ * to be null-terminated, for RecordFile::appendBatch()
+ */
+typedef struct {
+  int         key;
+  const char* value;
+  int         length;
+} RecordRef;
+
 /**
  * read/write a record to a file
  */
@@ -52,20 +63,63 @@ class RecordFile {
     // Note that we subtract sizeof(int) from PAGE_SIZE because the first
     // four bytes in the page is used to store # records in the page.
 
+  /**
+   * how the records of a file are stored:
+   *   PLAIN       a page of RECORDS_PER_PAGE records after another
+   *   COMPRESSED  the pages are stored compressed (see open())
+   *   COLUMNAR    the keys and the values are stored apart (see open())
+   */
+  typedef enum { PLAIN, COMPRESSED, COLUMNAR } Storage;
+
+  // # records in a key page of a columnar file
+  static const int KEYS_PER_ZONE = (PageFile::PAGE_SIZE - 3 * sizeof(int) - 32) / sizeof(int);
+
+  // the most records in a zone (see readZone())
+  static const int MAX_ZONE_RECORDS = KEYS_PER_ZONE;
+
   RecordFile();
   RecordFile(const std::string& filename, char mode);
   
   /**
    * open a file in read or write mode.
    * when opened in 'w' mode, if the file does not exist, it is created.
+   * the pages of a compressed file are stored in the PageFile as blocks:
+   * the distinct values of a page are kept once (a dictionary that the
+   * records refer to), and the result is compressed with LZCodec.
+   * a columnar file keeps the keys in the file itself, KEYS_PER_ZONE to
+   * a page after a header page, and the values in a file whose name ends
+   * in ".val" instead of ".tbl". a scan that needs the keys only reads
+   * about a twenty-fifth of the bytes of a plain file.
+   * a file whose name ends in ".tbl" has a zone map in the file ending in
+   * ".zm" instead, which append() maintains (see getZoneMap()).
+   * compressed and columnar files are read and appended to like any
+   * other, through the record ids that they would have as plain files.
    * @param filename[IN] the name of the file to open
    * @param mode[IN] 'r' for read, 'w' for write
+   * @param storage[IN] the storage of a new file (an existing file keeps
+   * its own)
    * @return error code. 0 if no error
    */
-  RC open(const std::string& filename, char mode);
+  RC open(const std::string& filename, char mode, Storage storage = PLAIN);
+
+  /**
+   * @return true if the pages of the file are stored compressed
+   */
+  bool isCompressed() const { return pf.isCompressed(); }
+
+  /**
+   * @return true if the keys and the values are stored apart
+   */
+  bool isColumnar() const { return columnar; }
 
   /**
-   * close the file.
+   * @return # pages of the values of a columnar file (0 for other files)
+   */
+  int getValuePageCount() const { return columnar ? valuePf.endPid() : 0; }
+
+  /**
+   * close the file, writing the last page if it has records that are
+   * not written yet.
    * @return error code. 0 if no error
    */
   RC close();
@@ -79,10 +133,63 @@ class RecordFile {
    */
   RC read(const RecordId& rid, int& key, std::string& value) const;
 
+  /**
+   * read all records of a page, bypassing the page cache.
+   * like read(), it is safe to call from several threads at once.
+   * @param pid[IN] the page to read
+   * @param count[OUT] # records in the page
+   * @param keys[OUT] the keys of the records (RECORDS_PER_PAGE entries)
+   * @param values[OUT] the values of the records (RECORDS_PER_PAGE entries)
+   * @return error code. 0 if no error
+   */
+  RC readPage(PageId pid, int& count, int keys[], std::string values[]) const;
+
+  /**
+   * a scan reads the file zone by zone. a zone is a page of a plain or a
+   * compressed file and a key page of a columnar file, whose records are
+   * summarized in the zone map of the file.
+   * @return # zones in the file
+   */
+  int getZoneCount() const;
+
+  /**
+   * @return the zone map of the file. it may have fewer zones than the
+   * file, or none: the zones that it does not have are not summarized.
+   * the zone map of a file opened in 'w' mode is brought up to date with
+   * the file when it is opened, and a file opened in 'r' mode uses the
+   * zones that summarize all of their records only.
+   */
+  const ZoneMap& getZoneMap() const { return zones; }
+
+  /**
+   * read all records of a zone, bypassing the page cache.
+   * like read(), it is safe to call from several threads at once.
+   * @param zone[IN] the zone to read
+   * @param count[OUT] # records in the zone
+   * @param keys[OUT] the keys of the records (MAX_ZONE_RECORDS entries)
+   * @param values[OUT] the values of the records (MAX_ZONE_RECORDS
+   * entries)
+   * @return error code. 0 if no error
+   */
+  RC readZone(int zone, int& count, int keys[], std::string values[]) const;
+
+  /**
+   * read the keys of a zone as readZone() does. the values of a columnar
+   * file are not read.
+   * @param zone[IN] the zone to read
+   * @param count[OUT] # records in the zone
+   * @param keys[OUT] the keys of the records (MAX_ZONE_RECORDS entries)
+   * @return error code. 0 if no error
+   */
+  RC readZoneKeys(int zone, int& count, int keys[]) const;
+
   /**
    * append a new record at the end of the file.
    * note that RecordFile does not have write() function.
    * append is the only way to write a record to a RecordFile.
+   * the last page of the file is kept in memory while records are
+   * appended to it, and is written to the disk once it is full, or by
+   * flush() or close(). read() sees the records that are not written yet.
    * @param key[IN] the record key
    * @param value[IN] the record value
    * @param rid[OUT] the location of the stored record
@@ -90,6 +197,33 @@ class RecordFile {
    */
   RC append(int key, const std::string& value, RecordId& rid);
 
+  /**
+   * append a new record whose value is given as a character array,
+   * which does not have to be null-terminated.
+   * @param key[IN] the record key
+   * @param value[IN] the record value
+   * @param length[IN] the length of the value
+   * @param rid[OUT] the location of the stored record
+   * @return error code. 0 if no error
+   */
+  RC append(int key, const char* value, int length, RecordId& rid);
+
+  /**
+   * append many records at the end of the file, as append() does.
+   * the records get consecutive record ids.
+   * @param records[IN] the records to append
+   * @param count[IN] the # records
+   * @param first[OUT] the record id of the first record
+   * @return error code. 0 if no error
+   */
+  RC appendBatch(const RecordRef* records, int count, RecordId& first);
+
+  /**
+   * write the records that were appended to the last page to the disk.
+   * @return error code. 0 if no error
+   */
+  RC flush();
+
   /**
    * note the +1 part. The rid of the last record is endRid()-1.
    * @return (last record id + 1) of the RecordFile
@@ -97,8 +231,34 @@ class RecordFile {
   const RecordId& endRid() const;
 
  private:
-  PageFile pf;     // the PageFile used to store the records
+  // open the zone map of the file (see getZoneMap())
+  void openZoneMap(const std::string& filename, char mode);
+
+  // the columnar counterparts of open(), read() and append()
+  RC openColumns(const std::string& filename, char mode);
+  RC readColumns(int row, int& key, std::string& value) const;
+  RC appendColumns(int key, const char* value, int length, RecordId& rid);
+
+  // read a key page or a value page of a columnar file, from the pages
+  // kept in memory if they are not written yet
+  RC readKeyPage(int zone, char* page, bool direct) const;
+  RC readValuePage(PageId pid, char* page, bool direct) const;
+
+  PageFile pf;     // the PageFile used to store the records (the keys of a columnar file)
   RecordId erid;   // the last record id of the file + 1
+
+  char   tail[PageFile::PAGE_SIZE];  // the last page while records are appended to it
+  PageId tailPid;    // the page in tail (-1 if none)
+  bool   tailDirty;  // true if tail has records that are not written yet
+  ZoneMap  zones;    // the summaries of the zones of the file
+
+  bool     columnar;    // true if the keys and the values are stored apart
+  int      rowCount;    // COLUMNAR: # records
+  PageFile valuePf;     // COLUMNAR: the values
+
+  char   valueTail[PageFile::PAGE_SIZE];  // COLUMNAR: the last value page
+  PageId valueTailPid;    // the page in valueTail (-1 if none)
+  bool   valueTailDirty;  // true if valueTail has values that are not written yet
 };
 
 #endif // RECORDFILE_H
@@ -0,0 +1,212 @@
+/**
+ * ResultSink: buffered output of query results.
+ */
+
+#include <cstring>
+#include "ResultSink.h"
+
+ResultSink::ResultSink(FILE* file)
+{
+  this->file = file;
+  format = TEXT;
+  buffer = NULL;
+  used = 0;
+  inRow = false;
+}
+
+ResultSink::~ResultSink()
+{
+  flush();
+  delete [] buffer;
+}
+
+void ResultSink::setFormat(Format format)
+{
+  flush();
+  this->format = format;
+}
+
+ResultSink::Format ResultSink::getFormat() const
+{
+  return format;
+}
+
+void ResultSink::writeBuffer()
+{
+  if (used > 0) fwrite(buffer, 1, used, file);
+  used = 0;
+}
+
+char* ResultSink::reserve(int length)
+{
+  if (buffer == NULL) buffer = new char[BUFFER_SIZE];
+  if (used + length > BUFFER_SIZE) {
+    writeBuffer();
+    if (length > BUFFER_SIZE) return NULL;
+  }
+  return buffer + used;
+}
+
+void ResultSink::append(const char* data, int length)
+{
+  char* p = reserve(length);
+  if (p == NULL) {
+    // a piece larger than the buffer goes straight to the file
+    fwrite(data, 1, length, file);
+    return;
+  }
+  memcpy(p, data, length);
+  used += length;
+}
+
+void ResultSink::flush()
+{
+  writeBuffer();
+  fflush(file);
+}
+
+// the two digits of every number from 00 to 99
+static const char DIGIT_PAIRS[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+int ResultSink::formatInt(long long n, char* buf)
+{
+  // the digits are written two at a time from the end of a scratch
+  // buffer, then copied to the front of buf
+  char  digits[20];
+  char* p = digits + sizeof(digits);
+  unsigned long long u = (n < 0) ? 0ULL - (unsigned long long)n : n;
+  while (u >= 100) {
+    unsigned d = (unsigned)(u % 100) * 2;
+    u /= 100;
+    *--p = DIGIT_PAIRS[d + 1];
+    *--p = DIGIT_PAIRS[d];
+  }
+  if (u >= 10) {
+    *--p = DIGIT_PAIRS[u * 2 + 1];
+    *--p = DIGIT_PAIRS[u * 2];
+  } else {
+    *--p = (char)('0' + u);
+  }
+
+  int length = digits + sizeof(digits) - p;
+  if (n < 0) *buf++ = '-';
+  memcpy(buf, p, length);
+  return length + (n < 0 ? 1 : 0);
+}
+
+char* ResultSink::startColumn(int length)
+{
+  // room for the separator and the column
+  char* p = reserve(length + 1);
+  if (inRow && format != BINARY) *p++ = (format == TSV) ? '\t' : ' ';
+  inRow = true;
+  return p;
+}
+
+void ResultSink::putInt(int n)
+{
+  char* p = startColumn(16);
+  if (format == BINARY) {
+    *p++ = 'i';
+    for (int i = 0; i < 4; i++) *p++ = (char)(n >> (8 * i));
+  } else {
+    p += formatInt(n, p);
+  }
+  used = p - buffer;
+}
+
+void ResultSink::putLong(long long n)
+{
+  char* p = startColumn(32);
+  if (format == BINARY) {
+    *p++ = 'l';
+    for (int i = 0; i < 8; i++) *p++ = (char)(n >> (8 * i));
+  } else {
+    p += formatInt(n, p);
+  }
+  used = p - buffer;
+}
+
+void ResultSink::putDouble(double d)
+{
+  char* p = startColumn(32);
+  if (format == BINARY) {
+    unsigned long long bits;
+    memcpy(&bits, &d, sizeof(bits));
+    *p++ = 'd';
+    for (int i = 0; i < 8; i++) *p++ = (char)(bits >> (8 * i));
+  } else {
+    p += sprintf(p, "%.10g", d);
+  }
+  used = p - buffer;
+}
+
+void ResultSink::putValue(const char* value, int length, bool quote)
+{
+  char* p = startColumn(5);
+  used = p - buffer;
+  switch (format) {
+  case TEXT: {
+    const char* end = (const char*)memchr(value, 0, length);
+    if (end != NULL) length = end - value;
+    if ((p = reserve(length + 2)) == NULL) {
+      append("'", quote ? 1 : 0);
+      append(value, length);
+      append("'", quote ? 1 : 0);
+      break;
+    }
+    if (quote) *p++ = '\'';
+    memcpy(p, value, length);
+    p += length;
+    if (quote) *p++ = '\'';
+    used = p - buffer;
+    break;
+  }
+  case TSV: {
+    // copy the runs of characters that need no escaping in one piece
+    const char* run = value;
+    for (const char* c = value; c < value + length; c++) {
+      const char* escape;
+      switch (*c) {
+      case '\t': escape = "\\t"; break;
+      case '\n': escape = "\\n"; break;
+      case '\\': escape = "\\\\"; break;
+      default: continue;
+      }
+      append(run, c - run);
+      append(escape, 2);
+      run = c + 1;
+    }
+    append(run, value + length - run);
+    break;
+  }
+  case BINARY: {
+    *p++ = 's';
+    for (int i = 0; i < 4; i++) *p++ = (char)(length >> (8 * i));
+    used = p - buffer;
+    append(value, length);
+    break;
+  }
+  }
+}
+
+void ResultSink::putNull()
+{
+  used = startColumn(0) - buffer;
+  switch (format) {
+  case TEXT:   append("NULL", 4); break;
+  case TSV:    append("\\N", 2); break;
+  case BINARY: append("n", 1); break;
+  }
+}
+
+void ResultSink::endRow()
+{
+  char* p = reserve(1);
+  *p = '\n';
+  used++;
+  inRow = false;
+}
@@ -0,0 +1,116 @@
+/**
+ * ResultSink collects the rows of query results in a large buffer and
+ * writes them out in one piece when the buffer is full or when it is
+ * flushed at the end of a query. A row is written column by column in
+ * one of three formats:
+ *
+ *   TEXT    the columns separated by a space, a value in quotes where
+ *           the query prints it so (the format of the Bruinbase shell)
+ *   TSV     the columns separated by a tab, with the tabs, line breaks
+ *           and backslashes in values escaped as \t, \n and \\
+ *   BINARY  every column is a type byte and its data: 'i' and a 32-bit
+ *           integer, 'l' and a 64-bit integer, 'd' and a 64-bit double,
+ *           's' and a 32-bit length followed by the value, or 'n' for
+ *           NULL. a row ends with the byte '\n'. numbers are little-endian
+ */
+
+#ifndef RESULTSINK_H
+#define RESULTSINK_H
+
+#include <cstdio>
+
+class ResultSink {
+ public:
+  typedef enum { TEXT, TSV, BINARY } Format;
+
+  // # bytes of rows that are buffered before they are written
+  static const int BUFFER_SIZE = 1 << 20;
+
+  /**
+   * @param file[IN] the file that the rows are written to
+   */
+  ResultSink(FILE* file);
+  ~ResultSink();
+
+  /**
+   * set the format of the rows that are written from now on.
+   * the rows in the buffer are flushed first.
+   * @param format[IN] the new format
+   */
+  void setFormat(Format format);
+
+  /**
+   * @return the format of the rows
+   */
+  Format getFormat() const;
+
+  /**
+   * write a column of the current row.
+   * @param n[IN] an integer column
+   */
+  void putInt(int n);
+  void putLong(long long n);
+
+  /**
+   * write a floating-point column in the %.10g form.
+   * @param d[IN] the number
+   */
+  void putDouble(double d);
+
+  /**
+   * write a value column. in TEXT, the value ends at its first null
+   * character, as it would with printf.
+   * @param value[IN] the value
+   * @param length[IN] the length of the value
+   * @param quote[IN] true if TEXT puts the value in quotes
+   */
+  void putValue(const char* value, int length, bool quote);
+
+  /**
+   * write a NULL column (the result of an aggregate over no tuples)
+   */
+  void putNull();
+
+  /**
+   * end the current row.
+   */
+  void endRow();
+
+  /**
+   * write the buffered rows to the file and flush it.
+   */
+  void flush();
+
+  /**
+   * write an integer in decimal, as "%lld" does, without the
+   * terminating null character.
+   * @param n[IN] the integer
+   * @param buf[OUT] the digits (at most 20 characters)
+   * @return the # characters written
+   */
+  static int formatInt(long long n, char* buf);
+
+ private:
+  // start a column that takes at most length bytes, with a separator if
+  // it is not the first of the row. returns where the column goes
+  char* startColumn(int length);
+
+  // make room for length bytes at the end of the buffer, writing it out
+  // if it is full. returns where they go (NULL if they would not fit in
+  // an empty buffer)
+  char* reserve(int length);
+
+  // append bytes to the buffer, writing it out when it is full
+  void append(const char* data, int length);
+
+  // write the buffered bytes to the file
+  void writeBuffer();
+
+  FILE*             file;
+  Format            format;
+  char*             buffer;   // allocated when the first row is written
+  int               used;     // # bytes in the buffer
+  bool              inRow;    // true after the first column of a row
+};
+
+#endif // RESULTSINK_H
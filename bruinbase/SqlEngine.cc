@@ -8,15 +8,28 @@
  */
 
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <iostream>
 #include <fstream>
 #include "Bruinbase.h"
 #include "SqlEngine.h"
 #include "BTreeIndex.h"
+#include "TableStats.h"
+#include "HashAggregate.h"
+#include "ThreadPool.h"
+#include "BatchFormat.h"
+#include "ResultSink.h"
 #include <vector>
 #include <algorithm>
 #include <fstream>
 #include <set>
+#include <deque>
+#include <climits>
+#include <cmath>
 #define TESTING 0
 
 using namespace std;
@@ -32,69 +45,713 @@ bool operator<(const IndexEntry& a, const IndexEntry& b) {
 	return (a.key<b.key);
 }
 
+// the order of buffered (key, rid) index entries: by key only, so that a
+// stable sort keeps the entries of a key in load order
+struct IndexEntryOrder {
+  bool operator()(const pair<int, RecordId>& a, const pair<int, RecordId>& b) const {
+    return a.first < b.first;
+  }
+};
+
+// a closed range of keys [first, second]
+typedef pair<int, int> KeyRange;
+
+// access path picked by the planner for a SELECT statement
+typedef struct {
+  enum Method { NO_SCAN, FULL_SCAN, INDEX_SCAN, INDEX_ONLY, STATS_COUNT } method;
+  bool    hasStats;   // false if the plan was picked without statistics
+  vector<KeyRange> ranges;  // sorted, disjoint key ranges that the index scan covers
+  double  rows;       // estimated # tuples in the key range
+  double  scanCost;   // estimated # page reads of a full table scan
+  double  indexCost;  // estimated # page reads through the index (-1 if no index)
+} AccessPlan;
+
+// a tuple of a query result
+typedef struct {
+  int    key;
+  string value;
+} ResultTuple;
+
+// the order of an ORDER BY clause: a < b if a is printed before b.
+// ties are broken by the key, so that the order is always the same.
+struct ResultOrder {
+  int  attr;  // 1 - key, 2 - value
+  bool desc;
+  bool operator()(const ResultTuple& a, const ResultTuple& b) const {
+    if (attr == 2 && a.value != b.value)
+      return desc ? (a.value > b.value) : (a.value < b.value);
+    if (attr == 1 && desc)
+      return a.key > b.key;
+    return a.key < b.key;
+  }
+};
+
+// the tuples of a query result on their way to the screen. the tuples
+// are printed as soon as they are added unless they have to be sorted;
+// then they are kept until flushResults(), in a heap of the best ones if
+// there is a LIMIT. for an aggregate function, only the aggregate is kept,
+// and for GROUP BY the tuples go to a hash aggregation.
+typedef struct {
+  int    attr;      // attribute in the SELECT clause
+  SelectOptions options;
+  bool   sort;      // true if the tuples are not added in the output order
+  int    count;     // # tuples added so far
+  vector<ResultTuple> tuples;  // the tuples kept for sorting
+  long long   sum;  // SUM and AVG: the sum of the keys
+  ResultTuple best; // MIN and MAX: the smallest (largest) tuple so far
+  HashAggregate* groups;  // GROUP BY: the groups of the tuples (NULL if none)
+  RC     rc;        // the first error while adding a tuple
+} ResultSet;
+
+// a group of a GROUP BY query and its aggregates, held back for sorting
+typedef pair<ResultTuple, HashAggregate::Group> GroupRow;
+
+// the order of the groups of a GROUP BY query on the GROUP BY attribute
+struct GroupRowOrder {
+  ResultOrder order;
+  bool operator()(const GroupRow& a, const GroupRow& b) const {
+    return order(a.first, b.first);
+  }
+};
+
+// a full table scan with more than one thread reads the table in morsels
+// of MORSEL_PAGES zones (pages, or the key pages of a columnar table). the
+// morsels are merged into the query result in table order, and at most
+// MORSELS_AHEAD morsels per worker thread are scanned ahead of the one
+// that is merged.
+static const int MORSEL_PAGES = 64;
+static const int MORSELS_AHEAD = 4;
+
+// an index scan with more than one thread splits its key ranges at the
+// separator keys of the upper levels of the tree, and the parts are
+// scanned as morsels in key order. it is used when the key ranges are
+// estimated to hold at least as many tuples as a table scan morsel.
+static const int PARALLEL_INDEX_ROWS = MORSEL_PAGES * RecordFile::RECORDS_PER_PAGE;
+
+// what a worker keeps of the matching tuples of a morsel
+enum ScanKeep {
+  KEEP_COUNT,   // COUNT(*): the # tuples
+  KEEP_SUM,     // SUM and AVG: the # tuples and the sum of their keys
+  KEEP_BEST,    // MIN and MAX: the best tuple
+  KEEP_TUPLES   // everything else: the tuples themselves
+};
+
+// a parallel table or index scan, shared by the workers of its morsels
+typedef struct {
+  const RecordFile* rf;
+  const vector<Predicate>* preds;
+  bool        keysOnly;     // table scan: true if the values are not read
+  BTreeIndex* idx;    // index scan: the index (NULL for a table scan)
+  bool        readTuples;   // index scan: true if the tuples are read
+  bool        checkTuples;  // index scan: true if the tuples are checked
+  ScanKeep    keep;
+  int         limit;  // KEEP_TUPLES: # tuples a morsel needs at most (-1 if all)
+  ResultOrder order;  // KEEP_BEST: the order of the aggregate
+  int         stop;   // 1 once the query needs no more tuples (see scanStopped())
+  pthread_mutex_t lock;
+  pthread_cond_t  done;  // signaled when a morsel is done
+} ParallelScan;
+
+// a morsel of a parallel scan: the zones [first, last) of a table scan or
+// the key ranges of an index scan, and what its worker found in them
+typedef struct {
+  ParallelScan* scan;
+  PageId    first, last;
+  vector<KeyRange> ranges;
+  bool      done;    // true once the worker is done (under scan->lock)
+  RC        rc;      // error while reading the pages
+  int       count;   // # matching tuples
+  long long sum;     // KEEP_SUM: the sum of their keys
+  ResultTuple best;  // KEEP_BEST: the best of them
+  vector<ResultTuple> tuples;  // KEEP_TUPLES: the tuples
+} ScanMorsel;
+
+// true once the query thread has told the workers of a scan to stop. the
+// flag is read and written with atomic builtins, as the workers read it
+// while the query thread sets it
+static bool scanStopped(ParallelScan* scan)
+{
+  return __sync_fetch_and_add(&scan->stop, 0) != 0;
+}
+
+// # worker threads of a query and the pool that runs them (created when
+// a query first needs it)
+static int threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+static ThreadPool* threadPool = NULL;
+
+// the rows of the query results go to the standard output through a
+// buffer that is flushed at the end of every query
+static ResultSink output(stdout);
+
+// true if LOAD ... WITH INDEX creates indexes with compressed leaves
+static bool compressIndex = false;
+
+// the storage of the tables that LOAD creates
+static RecordFile::Storage tableStorage = RecordFile::PLAIN;
+
+static ThreadPool* getThreadPool()
+{
+  if (threadPool == NULL)
+    threadPool = new ThreadPool(threadCount);
+  return threadPool;
+}
+
 extern FILE* sqlin;
 int sqlparse(void);
 
-void getRidsFirstCond(SelCond condition, BTreeIndex& idx, set<IndexEntry>& resultsToCheck);
-void filterKeys(const vector<SelCond>& conds, set<IndexEntry>& results);
 bool valueSatisfiesConds(string& value, const vector<SelCond>& conds);
-void getRidsInRange(SelCond& lowerBound, SelCond& upperBound, BTreeIndex& idx, set<IndexEntry>& resultsToCheck);
-bool filterConds(vector<SelCond>& conds, SelCond& lowerBound, SelCond& upperBound);
+void getRidsInRanges(const vector<Predicate>& preds, const vector<KeyRange>& ranges, BTreeIndex& idx, int limit, vector<IndexEntry>& results);
+void getRidsInRangesBackward(const vector<Predicate>& preds, const vector<KeyRange>& ranges, BTreeIndex& idx, int limit, vector<IndexEntry>& results);
+void compilePredicate(const vector<SelCond>& conds, Predicate& pred);
+void compileWhere(const vector<vector<SelCond> >& conds, vector<Predicate>& preds);
+void getKeyRanges(const vector<Predicate>& preds, vector<KeyRange>& ranges);
+bool keySatisfiesPredicate(int key, const Predicate& pred);
+bool keySatisfiesWhere(int key, const vector<Predicate>& preds);
+bool tupleSatisfiesWhere(int key, string& value, const vector<Predicate>& preds);
+bool zoneMayMatch(const ZoneMap& zones, int zone, const vector<Predicate>& preds);
+void choosePlan(int attr, const string& table, const vector<Predicate>& preds, const SelectOptions& options, const RecordFile& rf, BTreeIndex* idx, AccessPlan& plan);
+
+
+// how the tuples of a query have to be read: MIN and MAX are the first
+// tuple in ascending (descending) order of their attribute, so they are
+// read like ORDER BY attr LIMIT 1, which the index can answer from the
+// first (last) entry in the key range. SUM, AVG and GROUP BY read every
+// tuple. returns the attribute that the scan has to read (as in the
+// SELECT clause: 1 - key, 2 - value, 3 - both, 4 - none).
+static int getScanOptions(int attr, const SelectOptions& options, SelectOptions& scan)
+{
+  scan = options;
+  if (options.groupAttr != 0) {
+    scan.orderAttr = 0;
+    scan.limit = -1;
+    return (attr == 2 || options.groupAttr == 2) ? 2 : 1;
+  }
+  switch (options.aggregate) {
+  case SelectOptions::NONE:
+    break;
+  case SelectOptions::MIN:
+  case SelectOptions::MAX:
+    scan.orderAttr = attr;
+    scan.desc = (options.aggregate == SelectOptions::MAX);
+    scan.limit = 1;
+    break;
+  case SelectOptions::SUM:
+  case SelectOptions::AVG:
+    scan.orderAttr = 0;
+    scan.limit = -1;
+    break;
+  }
+  return attr;
+}
 
+// true if a scan has to read the values of the tuples: for the value
+// column, ORDER BY value, or the value conditions of the WHERE clause.
+// scanAttr and scan are as getScanOptions() returns them.
+static bool scanReadsValues(int scanAttr, const SelectOptions& scan, const vector<Predicate>& preds)
+{
+  if (scanAttr == 2 || scanAttr == 3 || scan.orderAttr == 2)
+    return true;
+  for (unsigned i = 0; i < preds.size(); i++)
+    if (!preds[i].valueConds.empty())
+      return true;
+  return false;
+}
 
-//helper function to compare key conditions (EQ > GT/GE > LT/LE > NE)
-bool compareKeyConds (const SelCond& a, const SelCond& b) {
-    switch (a.comp) {
-        case SelCond::EQ:
-            return true;
-	        break;
-        case SelCond::GE:
-        case SelCond::GT:
-            if (b.comp == SelCond::EQ)
-                return false;
-            else if (b.comp == SelCond::GE || b.comp == SelCond::GT) {
-		        if (atoi(a.value) < atoi(b.value))
-			        return false;
-		        else if (atoi(a.value) == atoi(b.value)) { // break ties between two GT/GEs
-		            if (a.comp == SelCond::GE && b.comp == SelCond::GT) // choose b when 1) a: >=   b: >
-		                return false;
-		            else        // choose a when 1) a: >=    b: >=
-		                        //               2) a: >     b: >
-		                        //               3) a: >     b: >=
-		                return true;
-		        }
-		        else
-		            return true;
-	        }
-    	    else
-                return true;
-	        break;
-    case SelCond::LT:
-    case SelCond::LE:
-        if (b.comp == SelCond::EQ || b.comp == SelCond::GE || b.comp == SelCond::GT)
-            return false;
-        else if (b.comp == SelCond::LT || b.comp == SelCond::LE) {
-		    if (atoi(a.value) > atoi(b.value))
-			    return false;
-			else if (atoi(a.value) == atoi(b.value)) { // break ties between two LT/LEs
-			    if (a.comp == SelCond::LE && b.comp == SelCond::LT) // choose b when 1) a: <=   B: <
-			        return false;
-			    else    // choose a when 1) a: <=   b: <=
-			            //               2) a: <    b: <
-			            //               3) a: <    B: <=
-			        return true;
-			}
-			else
-			    return true;
-	    }
-        else
-            return true;
+// start a query result. ordered is true if the tuples will be added in
+// the order of the ORDER BY clause (or of the scan options of MIN and MAX).
+static void initResults(ResultSet& rs, int attr, const SelectOptions& options, bool ordered)
+{
+  rs.attr = attr;
+  rs.options = options;
+  if (options.aggregate != SelectOptions::NONE)
+    rs.sort = !ordered;
+  else
+    rs.sort = (options.orderAttr != 0 && !ordered && attr != 4);
+  rs.count = 0;
+  rs.tuples.clear();
+  rs.sum = 0;
+  rs.rc = 0;
+  rs.groups = NULL;
+  if (options.groupAttr != 0) {
+    bool best = (options.aggregate == SelectOptions::MIN || options.aggregate == SelectOptions::MAX);
+    rs.groups = new HashAggregate(options.groupAttr, best ? attr : 0, options.aggregate == SelectOptions::MAX);
+  }
+}
+
+static void printTuple(int attr, int key, const string& value)
+{
+  switch (attr) {
+  case 1:  // SELECT key
+    output.putInt(key);
+    break;
+  case 2:  // SELECT value
+    output.putValue(value.data(), value.size(), false);
+    break;
+  case 3:  // SELECT *
+    output.putInt(key);
+    output.putValue(value.data(), value.size(), true);
+    break;
+  }
+  output.endRow();
+}
+
+// add a tuple that satisfies the WHERE clause to a query result.
+// returns false if the result needs no more tuples.
+static bool addResult(ResultSet& rs, int key, const string& value)
+{
+  int limit = rs.options.limit;
+  if (limit == 0)
+    return false;
+
+  if (rs.groups != NULL) {
+    rs.count++;
+    rs.rc = rs.groups->add(key, value);
+    return (rs.rc == 0);
+  }
+
+  ResultTuple tuple;
+  tuple.key = key;
+
+  switch (rs.options.aggregate) {
+  case SelectOptions::NONE:
+    break;
+  case SelectOptions::MIN:
+  case SelectOptions::MAX: {
+    // in the order of the aggregate the first tuple is the answer
+    ResultOrder order = { rs.attr, rs.options.aggregate == SelectOptions::MAX };
+    tuple.value = value;
+    if (rs.count++ == 0 || order(tuple, rs.best))
+      rs.best = tuple;
+    return rs.sort;
+  }
+  case SelectOptions::SUM:
+  case SelectOptions::AVG:
+    rs.count++;
+    rs.sum += key;
+    return true;
+  }
+
+  if (!rs.sort) {
+    rs.count++;
+    if (rs.attr == 4)
+      return true;
+    printTuple(rs.attr, key, value);
+    return (limit < 0 || rs.count < limit);
+  }
+
+  tuple.value = value;
+  rs.count++;
+  if (limit < 0) {
+    rs.tuples.push_back(tuple);
+    return true;
+  }
+
+  // top-k: keep the limit best tuples in a heap with the worst on top
+  ResultOrder order = { rs.options.orderAttr, rs.options.desc };
+  if ((int)rs.tuples.size() < limit) {
+    rs.tuples.push_back(tuple);
+    push_heap(rs.tuples.begin(), rs.tuples.end(), order);
+  } else if (order(tuple, rs.tuples.front())) {
+    pop_heap(rs.tuples.begin(), rs.tuples.end(), order);
+    rs.tuples.back() = tuple;
+    push_heap(rs.tuples.begin(), rs.tuples.end(), order);
+  }
+  return true;
+}
+
+// print the result of the aggregate function (or COUNT(*)) of a query
+// over count tuples: NULL if there are none. a value is quoted if quote
+// is true.
+static void printAggregate(int attr, const SelectOptions& options, int count, long long sum, const ResultTuple& best, bool quote)
+{
+  if (options.aggregate == SelectOptions::NONE) {
+    output.putInt(count);
+    return;
+  }
+  if (count == 0) {
+    output.putNull();
+    return;
+  }
+  switch (options.aggregate) {
+  case SelectOptions::SUM:
+    output.putLong(sum);
+    break;
+  case SelectOptions::AVG:
+    output.putDouble((double)sum / count);
+    break;
+  default:
+    if (attr == 2)
+      output.putValue(best.value.data(), best.value.size(), quote);
+    else
+      output.putInt(best.key);
+    break;
+  }
+}
+
+// print the row of a group: the GROUP BY attribute (if it is in the
+// SELECT clause) and the aggregate of the group. SELECT attr ... GROUP BY
+// attr (distinct) prints the distinct groups only
+static void printGroup(const ResultSet& rs, const HashAggregate::Group& group, bool distinct)
+{
+  if (rs.options.showGroup || distinct) {
+    if (rs.options.groupAttr == 1)
+      output.putInt(group.key);
+    else
+      output.putValue(group.value.data(), group.value.size(), !distinct);
+  }
+  if (!distinct) {
+    ResultTuple best;
+    best.key = group.bestKey;
+    best.value = group.bestValue;
+    printAggregate(rs.attr, rs.options, group.count, group.sum, best, rs.options.showGroup);
+  }
+  output.endRow();
+}
+
+// print the groups of a GROUP BY query: the GROUP BY attribute (if it is
+// in the SELECT clause) and the aggregate of every group. the groups are
+// printed as they come out of the hash aggregation, unless they have to be
+// sorted on the GROUP BY attribute.
+static RC flushGroups(ResultSet& rs)
+{
+  HashAggregate::Group group;
+  vector<GroupRow>     rows;
+  GroupRow             row;
+  RC                   rc;
+  int                  printed = 0;
+
+  // SELECT attr ... GROUP BY attr prints the distinct groups only
+  bool distinct = (rs.options.aggregate == SelectOptions::NONE && rs.attr != 4);
+
+  while ((rc = rs.groups->getGroup(group)) == 0) {
+    if (rs.options.orderAttr != 0) {
+      row.first.key = group.key;
+      row.first.value = group.value;
+      row.second = group;
+      rows.push_back(row);
+      continue;
+    }
+    printGroup(rs, group, distinct);
+    if (++printed == rs.options.limit)
+      return 0;
+  }
+  if (rc != RC_END_OF_TREE)
+    return rc;
+
+  // ORDER BY the GROUP BY attribute
+  GroupRowOrder order = { { rs.options.groupAttr, rs.options.desc } };
+  unsigned count = rows.size();
+  if (rs.options.limit >= 0 && rs.options.limit < (int)rows.size())
+    count = rs.options.limit;
+  partial_sort(rows.begin(), rows.begin() + count, rows.end(), order);
+  for (unsigned i = 0; i < count; i++)
+    printGroup(rs, rows[i].second, distinct);
+  return 0;
+}
+
+// print the tuples of a query result that were held back for sorting,
+// the tuple count for SELECT COUNT(*), the aggregate (NULL if no tuple
+// satisfied the WHERE clause), or the groups of GROUP BY
+static RC flushResults(ResultSet& rs)
+{
+  RC rc = rs.rc;
+  if (rs.groups != NULL) {
+    if (rc == 0 && rs.options.limit != 0)
+      rc = flushGroups(rs);
+    delete rs.groups;
+    rs.groups = NULL;
+    return rc;
+  }
+  if (rs.options.aggregate != SelectOptions::NONE || rs.attr == 4) {
+    if (rs.options.limit != 0) {
+      printAggregate(rs.attr, rs.options, rs.count, rs.sum, rs.best, false);
+      output.endRow();
+    }
+    return 0;
+  }
+  if (!rs.sort)
+    return 0;
+
+  ResultOrder order = { rs.options.orderAttr, rs.options.desc };
+  if (rs.options.limit < 0)
+    sort(rs.tuples.begin(), rs.tuples.end(), order);
+  else
+    sort_heap(rs.tuples.begin(), rs.tuples.end(), order);
+  for (unsigned i = 0; i < rs.tuples.size(); i++)
+    printTuple(rs.attr, rs.tuples[i].key, rs.tuples[i].value);
+  rs.tuples.clear();
+  return 0;
+}
+
+
+// keep a matching tuple of a morsel
+static void keepTuple(ScanMorsel* m, int key, string& value)
+{
+  ParallelScan* scan = m->scan;
+
+  m->count++;
+  if (scan->keep == KEEP_SUM) {
+    m->sum += key;
+  } else if (scan->keep == KEEP_BEST) {
+    ResultTuple tuple;
+    tuple.key = key;
+    tuple.value = value;
+    if (m->count == 1 || scan->order(tuple, m->best))
+      m->best = tuple;
+  } else if (scan->keep == KEEP_TUPLES) {
+    m->tuples.push_back(ResultTuple());
+    m->tuples.back().key = key;
+    m->tuples.back().value.swap(value);
+  }
+}
+
+// tell the main thread that a morsel is done
+static void finishMorsel(ScanMorsel* m)
+{
+  pthread_mutex_lock(&m->scan->lock);
+  m->done = true;
+  pthread_cond_broadcast(&m->scan->done);
+  pthread_mutex_unlock(&m->scan->lock);
+}
+
+// scan the zones of a morsel on a worker thread
+static void scanMorsel(void* arg)
+{
+  ScanMorsel*   m = (ScanMorsel*)arg;
+  ParallelScan* scan = m->scan;
+  int    keys[RecordFile::MAX_ZONE_RECORDS];
+  string values[RecordFile::MAX_ZONE_RECORDS];
+  int    n;
+
+  m->rc = 0;
+  m->count = 0;
+  m->sum = 0;
+  for (int zone = m->first; zone < m->last && !scanStopped(scan); zone++) {
+    if (!zoneMayMatch(scan->rf->getZoneMap(), zone, *scan->preds))
+      continue;
+    if (scan->keysOnly)
+      m->rc = scan->rf->readZoneKeys(zone, n, keys);
+    else
+      m->rc = scan->rf->readZone(zone, n, keys, values);
+    if (m->rc < 0)
+      break;
+    for (int i = 0; i < n; i++) {
+      if (tupleSatisfiesWhere(keys[i], values[i], *scan->preds))
+        keepTuple(m, keys[i], values[i]);
+    }
+    if (scan->limit >= 0 && m->count >= scan->limit)
+      break;
+  }
+  finishMorsel(m);
+}
+
+// scan the key ranges of a morsel through the index on a worker thread
+static void scanIndexMorsel(void* arg)
+{
+  ScanMorsel*   m = (ScanMorsel*)arg;
+  ParallelScan* scan = m->scan;
+  vector<IndexEntry> entries;
+  int    key;
+  string value;
+
+  m->rc = 0;
+  m->count = 0;
+  m->sum = 0;
+  if (!scanStopped(scan))
+    getRidsInRanges(*scan->preds, m->ranges, *scan->idx, -1, entries);
+  for (unsigned i = 0; i < entries.size() && !scanStopped(scan); i++) {
+    if (scan->readTuples) {
+      if ((m->rc = scan->rf->read(entries[i].rid, key, value)) < 0)
         break;
-    default:
-        return false;
+      if (scan->checkTuples && !tupleSatisfiesWhere(key, value, *scan->preds))
+        continue;
+    }
+    keepTuple(m, entries[i].key, value);
+    if (scan->limit >= 0 && m->count >= scan->limit)
+      break;
+  }
+  finishMorsel(m);
+}
+
+// add the matching tuples of a morsel to a query result.
+// returns false if the result needs no more tuples.
+static bool mergeMorsel(ResultSet& rs, ScanMorsel& m)
+{
+  switch (m.scan->keep) {
+  case KEEP_COUNT:
+    rs.count += m.count;
+    return true;
+  case KEEP_SUM:
+    rs.count += m.count;
+    rs.sum += m.sum;
+    return true;
+  case KEEP_BEST:
+    if (m.count > 0)
+      addResult(rs, m.best.key, m.best.value);
+    return true;
+  case KEEP_TUPLES:
+    break;
+  }
+  for (unsigned i = 0; i < m.tuples.size(); i++) {
+    if (!addResult(rs, m.tuples[i].key, m.tuples[i].value))
+      return false;
+  }
+  return true;
+}
+
+// set up a parallel scan that adds the tuples satisfying preds to rs
+static void initScan(ParallelScan& scan, ResultSet& rs, const RecordFile& rf, const vector<Predicate>& preds)
+{
+  scan.rf = &rf;
+  scan.preds = &preds;
+  scan.keysOnly = false;
+  scan.idx = NULL;
+  scan.readTuples = scan.checkTuples = false;
+  scan.stop = 0;
+  scan.limit = -1;
+  scan.order.attr = rs.attr;
+  scan.order.desc = (rs.options.aggregate == SelectOptions::MAX);
+  if (rs.groups != NULL) {
+    scan.keep = KEEP_TUPLES;
+  } else if (rs.options.aggregate == SelectOptions::MIN || rs.options.aggregate == SelectOptions::MAX) {
+    scan.keep = KEEP_BEST;
+  } else if (rs.options.aggregate != SelectOptions::NONE) {
+    scan.keep = KEEP_SUM;
+  } else if (rs.attr == 4) {
+    scan.keep = KEEP_COUNT;
+  } else {
+    scan.keep = KEEP_TUPLES;
+    // the first LIMIT tuples of unsorted output are all that is printed
+    if (!rs.sort)
+      scan.limit = rs.options.limit;
+  }
+}
+
+// run the morsels of a parallel scan on the thread pool and merge them
+// into the query result in order as they are done
+static RC runMorsels(ResultSet& rs, ParallelScan& scan, vector<ScanMorsel>& morsels, ThreadPool::Task task)
+{
+  RC rc = 0;
+
+  pthread_mutex_init(&scan.lock, NULL);
+  pthread_cond_init(&scan.done, NULL);
+  for (unsigned i = 0; i < morsels.size(); i++) {
+    morsels[i].scan = &scan;
+    morsels[i].done = false;
+  }
+
+  ThreadPool* pool = getThreadPool();
+  unsigned ahead = pool->getWorkerCount() * MORSELS_AHEAD;
+  unsigned submitted = 0;
+  for (; submitted < morsels.size() && submitted < ahead; submitted++)
+    pool->submit(task, &morsels[submitted]);
+
+  for (unsigned i = 0; i < morsels.size(); i++) {
+    pthread_mutex_lock(&scan.lock);
+    while (!morsels[i].done)
+      pthread_cond_wait(&scan.done, &scan.lock);
+    pthread_mutex_unlock(&scan.lock);
+
+    if ((rc = morsels[i].rc) < 0)
+      break;
+    bool more = mergeMorsel(rs, morsels[i]);
+    vector<ResultTuple>().swap(morsels[i].tuples);
+    if (!more)
+      break;
+    if (submitted < morsels.size()) {
+      pool->submit(task, &morsels[submitted]);
+      submitted++;
+    }
+  }
+
+  // let the workers of the morsels that are not needed any more finish
+  __sync_fetch_and_or(&scan.stop, 1);
+  pthread_mutex_lock(&scan.lock);
+  for (unsigned i = 0; i < submitted; i++) {
+    while (!morsels[i].done)
+      pthread_cond_wait(&scan.done, &scan.lock);
   }
-} 
+  pthread_mutex_unlock(&scan.lock);
 
+  pthread_cond_destroy(&scan.done);
+  pthread_mutex_destroy(&scan.lock);
+  return rc;
+}
+
+// scan a table in morsels on the thread pool and add the tuples that
+// satisfy the WHERE clause to a query result, in table order. keysOnly is
+// true if the query needs the keys of the tuples only.
+static RC parallelScan(ResultSet& rs, const RecordFile& rf, const vector<Predicate>& preds, bool keysOnly)
+{
+  ParallelScan scan;
+  initScan(scan, rs, rf, preds);
+  scan.keysOnly = keysOnly;
+
+  // split the zones of the table into morsels
+  int zones = rf.getZoneCount();
+  vector<ScanMorsel> morsels((zones + MORSEL_PAGES - 1) / MORSEL_PAGES);
+  for (unsigned i = 0; i < morsels.size(); i++) {
+    morsels[i].first = i * MORSEL_PAGES;
+    morsels[i].last = min(zones, (int)((i + 1) * MORSEL_PAGES));
+  }
+
+  return runMorsels(rs, scan, morsels, scanMorsel);
+}
+
+// read the key ranges of a query through the index in parallel: the
+// ranges are split at separator keys of the tree into morsels that are
+// scanned on the thread pool, and the tuples are added to the query
+// result in key order. returns 1 (and does nothing) if the ranges do not
+// span enough subtrees of the index to be split.
+static RC parallelIndexScan(ResultSet& rs, const RecordFile& rf, BTreeIndex& idx, const vector<Predicate>& preds, const vector<KeyRange>& ranges, bool readTuples, bool checkTuples)
+{
+  ParallelScan scan;
+  vector<int>  separators;
+  RC           rc;
+
+  if (ranges.empty())
+    return 1;
+  int parts = threadCount * MORSELS_AHEAD;
+  if ((rc = idx.getSeparators(ranges.front().first, ranges.back().second, parts - 1, separators)) < 0)
+    return rc;
+  if (separators.empty())
+    return 1;
+
+  // a root with many keys gives more separators than needed: keep evenly
+  // spaced ones, so that a morsel is worth the cost of a task
+  if ((int)separators.size() >= parts) {
+    vector<int> kept;
+    for (int i = 1; i < parts; i++)
+      kept.push_back(separators[(long)i * separators.size() / parts]);
+    separators.swap(kept);
+  }
+
+  // the morsel between two separators holds the parts of the ranges
+  // between them. morsels without any part are left out
+  vector<ScanMorsel> morsels(1);
+  unsigned next = 0;
+  for (unsigned i = 0; i < ranges.size(); i++) {
+    KeyRange range = ranges[i];
+    while (next < separators.size() && separators[next] <= range.second) {
+      if (separators[next] > range.first) {
+        morsels.back().ranges.push_back(KeyRange(range.first, separators[next] - 1));
+        range.first = separators[next];
+      }
+      if (!morsels.back().ranges.empty())
+        morsels.push_back(ScanMorsel());
+      next++;
+    }
+    morsels.back().ranges.push_back(range);
+  }
+  if (morsels.size() < 2)
+    return 1;
+
+  initScan(scan, rs, rf, preds);
+  scan.idx = &idx;
+  scan.readTuples = readTuples;
+  scan.checkTuples = checkTuples;
+  return runMorsels(rs, scan, morsels, scanIndexMorsel);
+}
 
 RC SqlEngine::run(FILE* commandline)
 {
@@ -109,7 +766,14 @@ RC SqlEngine::run(FILE* commandline)
 }
 
 
-RC SqlEngine::select(int attr, const string &table, const vector<SelCond>&conds) {
+RC SqlEngine::select(int attr, const string& table, const vector<vector<SelCond> >& conds, const SelectOptions& options)
+{
+  RC rc = selectTable(attr, table, conds, options);
+  output.flush();
+  return rc;
+}
+
+RC SqlEngine::selectTable(int attr, const string &table, const vector<vector<SelCond> >&conds, const SelectOptions& options) {
 
     RecordFile rf;   // RecordFile containing the table
 
@@ -127,347 +791,605 @@ RC SqlEngine::select(int attr, const string &table, const vector<SelCond>&conds)
     }
 
 
-    // open the index file -- if it doesn't exist, perform linearScan
-    BTreeIndex index;
-    if (index.open(table + ".idx", 'r') < 0) {
-        //cout << "no index available, calling linear scan" << endl << endl;
-        linearScan(attr, rf, conds);
+    // PREPARE SELECT CONDITIONS
+    // parse the conditions once and fold the key conditions of every
+    // conjunction into a range
+    vector<Predicate> preds;
+    compileWhere(conds, preds);
+
+    // no tuple can satisfy the conditions -- nothing to read, but
+    // COUNT(*) and the aggregates still print their result
+    ResultSet results;
+    if (preds.empty()) {
+        initResults(results, attr, options, true);
+        rc = flushResults(results);
         rf.close();
-        return 0;
+        return rc;
     }
 
-	vector<SelCond> keyConds, valueConds;
-
-
-    // PREPARE SELECT CONDITIONS
-    // separate conds into keyConds (sorted) or valueConds
-    // scan entire table if no conditions
-    if (conds.empty()) {
-        if (attr == 2 || attr == 3) {  // value or *	
-		    //cout << "no conditions, calling linear scan" << endl << endl;
-            linearScan(attr, rf, conds);
-            index.close();
-			rf.close();
-            return 0;
-        }
-        else {
-		    SelCond condition;
-		    condition.comp=SelCond::GE;
-		    condition.attr=1;
-            char condValue = '0';
-		    condition.value = &condValue;
-    	    keyConds.push_back(condition);
-        }
-	}
-
-    for (int i = 0; i < conds.size(); i++)
-        if (conds[i].attr == 1)
-            keyConds.push_back(conds[i]);
-        else
-            valueConds.push_back(conds[i]);
-    //cout << "beginning sort" << endl;
-    sort(keyConds.begin(), keyConds.end(), compareKeyConds);
-    
-
-    // if keyConds is empty or contains only <> select conditions, scan entire table
-    if (keyConds.empty() || keyConds[0].comp == SelCond::NE) {
-        //cout << "calling linear scan" << endl;
-        linearScan(attr, rf, conds);
-        index.close();
-		rf.close();
+    // LIMIT 0 -- nothing to print
+    if (options.limit == 0) {
+        rf.close();
         return 0;
     }
- 
-/* 
-    for (int i = 0; i < keyConds.size(); i++) {
-        cout << i << " key ";
-        switch (keyConds[i].comp) {
-            case SelCond::NE: cout << "!="; break;
-            case SelCond::EQ: cout << "=="; break;
-            case SelCond::LT: cout << "<"; break;
-            case SelCond::LE: cout << "<="; break;
-            case SelCond::GT: cout << ">"; break;
-            case SelCond::GE: cout << ">="; break;
-        }
-        cout << " " << keyConds[i].value << endl;
-    }
-*/    
 
-    
-    // check if keyConds contains multiple EQ conditions
-    vector<SelCond> eqConds;
-    for (int i = 0; i < keyConds.size(); i++)
-        if (keyConds[i].comp == SelCond::EQ)
-            eqConds.push_back(keyConds[i]);
-            
-    // if more than one EQ cond, check that they all have the same value
-    bool sameValueEqConds = true;
-    if (eqConds.size() > 1) {
-        SelCond temp = eqConds[0];
-        for (int i = 1; i < eqConds.size(); i++) {
-            if (temp.value != eqConds[i].value) {
-                sameValueEqConds = false;
-                break;
-            }
-        }
-    }
-    
-    // there are more than one EQ conds and they have different values
-    if (!sameValueEqConds) {
-        if (attr == 4)
-            cout << "0" << endl;
-        index.close();
+
+    // open the index file -- if it doesn't exist, perform linearScan
+    BTreeIndex index;
+    indexExists = (index.open(table + ".idx", 'r') == 0);
+
+    // PICK ACCESS PATH
+    // scan the table if reading it is cheaper than going through the index
+    SelectOptions scan;
+    int scanAttr = getScanOptions(attr, options, scan);
+    AccessPlan plan;
+    choosePlan(scanAttr, table, preds, scan, rf, indexExists ? &index : NULL, plan);
+    if (plan.method == AccessPlan::STATS_COUNT) {
+        output.putLong(llround(plan.rows));
+        output.endRow();
+        if (indexExists)
+            index.close();
         rf.close();
         return 0;
     }
-    
-    
-    
-    // filter keyConds and obtain range of keys to check (if it exists)
-    set<IndexEntry> resultsToCheck;
-    SelCond lowerBound, upperBound;
-    
-    //cout << "select: testing1" << endl;
-    bool rangeExists = filterConds(keyConds, lowerBound, upperBound);
-    //cout << "select: testing2" << endl;
-    
-/*
-    for (int i = 0; i < keyConds.size(); i++) {
-        cout << i << " key ";
-        switch (keyConds[i].comp) {
-            case SelCond::NE: cout << "!="; break;
-            case SelCond::EQ: cout << "=="; break;
-            case SelCond::LT: cout << "<"; break;
-            case SelCond::LE: cout << "<="; break;
-            case SelCond::GT: cout << ">"; break;
-            case SelCond::GE: cout << ">="; break;
-        }
-        cout << " " << keyConds[i].value << endl;
-    }
-
-*/
-    if (rangeExists) {
-        //cout << "select: range exists" << endl;
-        // if invalid range, return 0 tuples
-        // case 1: lower bound > upper bound OR
-        // case 2: lower bound < key < lower bound+1    e.g. 14 < key < 15
-        if ((atoi(lowerBound.value) >= atoi(upperBound.value)) ||
-             (atoi(lowerBound.value)+1 == atoi(upperBound.value) &&
-             lowerBound.comp == SelCond::GT &&
-             upperBound.comp == SelCond::LT)) {
-            if (attr == 4)
-                cout << "0" << endl;
+    if (plan.method == AccessPlan::FULL_SCAN) {
+        rc = linearScan(attr, rf, preds, options);
+        if (indexExists)
             index.close();
-			rf.close();
-            return 0;
-        }
-        
-        // valid range
-        else {
-            //cout << "select: valid range" << endl;
-            //cout << "select: starting getRidsInRange" << endl;
-            getRidsInRange(lowerBound, upperBound, index, resultsToCheck);
-            //cout << "select: done with getRidsInRange" << endl;
-            //cout << "select: # returned keys: " << resultsToCheck.size() << endl; 
-        }
+        rf.close();
+        return rc;
     }
-    
-    else {
-        //cout << "select: range doesn't exist" << endl;
-        // get keys that satisfy first condition
-        //cout << "select: starting getRidsFirstCond" << endl;
-        getRidsFirstCond(keyConds[0], index, resultsToCheck);
-        //cout << "select: done with getRidsFirstCond" << endl;
-        //cout << "select: # returned keys: " << resultsToCheck.size() << endl; 
-    
-        // if no such keys, return
-        if (resultsToCheck.empty()) {
-            if (attr == 4)
-                cout << "0" << endl;
+
+
+    // the value conditions have to be checked on the tuples, together with
+    // the key conditions of their conjunction
+    bool checkTuples = false;
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (!preds[i].valueConds.empty())
+            checkTuples = true;
+
+    // the index returns the tuples in key order (walking the leaves
+    // backward for ORDER BY key DESC), so ORDER BY key needs no sorting,
+    // and the index scan can stop after LIMIT entries unless some of them
+    // may fail the value conditions
+    initResults(results, attr, options, scan.orderAttr == 1);
+    int limit = (checkTuples || results.sort || attr == 4) ? -1 : scan.limit;
+
+    // the tuples are read for the value conditions and the value column only
+    bool readTuples = (checkTuples || scanAttr == 2 || scanAttr == 3 || scan.orderAttr == 2);
+
+    // a wide forward scan of the whole key range is split among the
+    // worker threads
+    if (threadCount > 1 && limit < 0 && !(scan.orderAttr == 1 && scan.desc) &&
+        (!plan.hasStats || plan.rows >= PARALLEL_INDEX_ROWS)) {
+        rc = parallelIndexScan(results, rf, index, preds, plan.ranges, readTuples, checkTuples);
+        if (rc <= 0) {
+            if (rc == 0)
+                rc = flushResults(results);
+            else
+                delete results.groups;
             index.close();
-			rf.close();
-            return 0;
+            rf.close();
+            return rc;
         }
-        
-        // filter keys using remaining conditions
-        //cout << "select: starting filterKeys" << endl;
-        filterKeys(keyConds, resultsToCheck);
-        //cout << "select: done with filterKeys" << endl;
-        //cout << "select: # returned keys after filter: " << resultsToCheck.size() << endl; 
     }
 
+    // read the index entries whose keys satisfy the key conditions
+    vector<IndexEntry> resultsToCheck;
+    if (scan.orderAttr == 1 && scan.desc)
+        getRidsInRangesBackward(preds, plan.ranges, index, limit, resultsToCheck);
+    else
+        getRidsInRanges(preds, plan.ranges, index, limit, resultsToCheck);
+
 
     // PRINT TUPLES
-    // no valueConds to check -- proceed to print tuples
-    if (valueConds.empty()) {
-        switch (attr) {
-    
-            case 1:    // print key
-                for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++)
-                    cout << it->key << endl;
-                break;
-      
-            case 2:    // print value
-                for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
-                    rf.read(it->rid, key, value);
-                    cout << value << endl;
-                }
-                break;
-    
-            case 3:    // print key and value
-                for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
-                    rf.read(it->rid, key, value);
-                    cout << key << " '" << value << "'" << endl;
-			    }
-                break;
-      
-            case 4:    // print count
-                cout << resultsToCheck.size() << endl;
-                break;
-            }
-    }
-  
-    // there are value conds -- apply them before printing tuples
-    else {
-        switch (attr) {
-    
-        case 1:    // print key if value satisfies valueConds
-            for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
-                rf.read(it->rid, key, value);
-                if (valueSatisfiesConds(value, valueConds))
-                    cout << it->key << endl;
-            }
-            break;
-      
-        case 2:    // print value if it satisfies valueConds
-            for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
-                rf.read(it->rid, key, value);
-                if (valueSatisfiesConds(value, valueConds))
-                    cout << value << endl;
+    for (vector<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
+        if (readTuples) {
+            if ((rc = rf.read(it->rid, key, value)) < 0) {
+                delete results.groups;
+                index.close();
+                rf.close();
+                return rc;
             }
-            break;
-    
-        case 3:    // print key and value if value satisfies valueConds
-            for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
-                rf.read(it->rid, key, value);
-                if (valueSatisfiesConds(value, valueConds))
-                    cout << key << " '" << value << "'" << endl;
-            }
-            break;
-      
-        case 4:    // print count of values that satisfy valueConds
-            int count = 0;
-            for (set<IndexEntry>::iterator it = resultsToCheck.begin(); it != resultsToCheck.end(); it++) {
-                rf.read(it->rid, key, value);
-                if (valueSatisfiesConds(value, valueConds))
-                    count++;
-            }
-            cout << count << endl;
-            break;
+            if (checkTuples && !tupleSatisfiesWhere(key, value, preds))
+                continue;
         }
+        if (!addResult(results, it->key, value))
+            break;
     }
+    rc = flushResults(results);
   
   
     // CLEAN UP
     //close the table file and return
     index.close();
 	rf.close();
-    return 0;
+    return rc;
 }
     
 
-// if range exists, return true and the SelConds for lower and upper bounds, else false
-// note: this function does not check if the range is valid
-bool filterConds(vector<SelCond>& conds, SelCond& lowerBound, SelCond& upperBound) {
-    vector<SelCond> temp;
-    SelCond lowerTemp, upperTemp;
-    
-    bool rangeExists = false;
-    
-    //cout << "filterConds: testing1" << endl;
-    // check if range exists by attempting to get lower and upper bounds
-    bool lowerBoundFound = false;
-    bool upperBoundFound = false;
-
-    //cout << "filterConds: testing2" << endl;    
-    for (int i = 0; i < conds.size() && (!lowerBoundFound || !upperBoundFound); i++)
-        if (!lowerBoundFound && (conds[i].comp == SelCond::GT || conds[i].comp == SelCond::GE)) {
-            lowerTemp = conds[i];
-            lowerBoundFound = true;
-        }
-        else if (!upperBoundFound && (conds[i].comp == SelCond::LT || conds[i].comp == SelCond::LE)) {
-            upperTemp = conds[i];
-            upperBoundFound = true;
-        }
-    rangeExists = lowerBoundFound && upperBoundFound;
-    
-    //cout << "filterConds: testing3" << endl;
-    // range exists
-    if (rangeExists) {
-        //cout << "filterConds: testing4" << endl;
-        // return lower and upper bounds
-        lowerBound = lowerTemp;
-        upperBound = upperTemp;
-        
-        // create new conds vector with only NE and EQ conditions
-        for (int i = 0; i < conds.size(); i++)
-            if (conds[i].comp == SelCond::NE || conds[i].comp == SelCond::EQ)
-                temp.push_back(conds[i]);
+RC SqlEngine::explain(int attr, const string& table, const vector<vector<SelCond> >& conds, const SelectOptions& options)
+{
+  RecordFile rf;
+  BTreeIndex index;
+  AccessPlan plan;
+  bool       indexExists;
+  RC         rc;
+
+  if ((rc = rf.open(table + ".tbl", 'r')) < 0) {
+    fprintf(stderr, "Error: table %s does not exist\n", table.c_str());
+    return rc;
+  }
+  indexExists = (index.open(table + ".idx", 'r') == 0);
+
+  vector<Predicate> preds;
+  SelectOptions     scan;
+  compileWhere(conds, preds);
+  int scanAttr = getScanOptions(attr, options, scan);
+  choosePlan(scanAttr, table, preds, scan, rf, indexExists ? &index : NULL, plan);
+
+  // print the chosen access path
+  switch (plan.method) {
+  case AccessPlan::NO_SCAN:
+    fprintf(stdout, "  plan: no tuple can satisfy the conditions, nothing is read\n");
+    break;
+  case AccessPlan::FULL_SCAN:
+    fprintf(stdout, "  plan: full scan of %s.tbl", table.c_str());
+    if (rf.isColumnar())
+      fprintf(stdout, scanReadsValues(scanAttr, scan, preds) ? " and %s.val" : " (the key column only)", table.c_str());
+    fprintf(stdout, "\n");
+    if (rf.getZoneMap().getZoneCount() > 0) {
+      // the zones that the zone map does not summarize are read anyway
+      int zones = rf.getZoneCount();
+      int read = 0;
+      for (int zone = 0; zone < zones; zone++)
+        if (zoneMayMatch(rf.getZoneMap(), zone, preds))
+          read++;
+      fprintf(stdout, "  zone map: %d of %d zones are read\n", read, zones);
     }
-    
-    // range doesn't exist
-    else {
-        //cout << "filterConds: testing5" << endl;
-        bool lowerBoundAdded = false;
-        bool upperBoundAdded = false;
-        
-        // create new conds vector with only one GT/GE or only one LT/LE
-        // note: this code assumes the conds vector is "sorted"
-        for (int i = 0; i < conds.size(); i++) {
-            switch (conds[i].comp) {
-                case SelCond::EQ:  temp.push_back(conds[i]);
+    break;
+  case AccessPlan::INDEX_SCAN:
+    fprintf(stdout, "  plan: index scan of %s.idx, fetching tuples from %s.tbl\n", table.c_str(), table.c_str());
+    break;
+  case AccessPlan::INDEX_ONLY:
+    fprintf(stdout, "  plan: index-only scan of %s.idx\n", table.c_str());
+    break;
+  case AccessPlan::STATS_COUNT:
+    fprintf(stdout, "  plan: tuple count from the statistics of %s\n", table.c_str());
+    break;
+  }
+
+  // print how the aggregate, ORDER BY and LIMIT are carried out
+  bool indexOrder = (plan.method == AccessPlan::INDEX_SCAN || plan.method == AccessPlan::INDEX_ONLY);
+  if (options.groupAttr != 0) {
+    // the # groups is the # distinct values of the GROUP BY attribute
+    TableStats groupStats;
+    const char* column = (options.groupAttr == 1) ? "key" : "value";
+    fprintf(stdout, "  group by %s: hash aggregation", column);
+    if (plan.hasStats && groupStats.open(table) == 0) {
+      double groups = (options.groupAttr == 1) ? groupStats.getDistinctKeys() : groupStats.getDistinctValues();
+      double length = (options.groupAttr == 1) ? sizeof(int) : groupStats.getAvgValueLength();
+      fprintf(stdout, ", ~%.0f groups", groups);
+      if (groups * (length + 64) > HashAggregate::MEMORY)
+        fprintf(stdout, ", partitioned to disk");
+    }
+    fprintf(stdout, "\n");
+  }
+  if (options.aggregate != SelectOptions::NONE) {
+    static const char* names[] = { "", "min", "max", "sum", "avg" };
+    const char* column = (attr == 1) ? "key" : "value";
+    if (indexOrder && scan.orderAttr == 1)
+      fprintf(stdout, "  %s(%s): the %s index entry in the key range\n", names[options.aggregate], column,
+        scan.desc ? "last" : "first");
+    else if (plan.method == AccessPlan::INDEX_ONLY)
+      fprintf(stdout, "  %s(%s): from the index leaves, no tuples are read\n", names[options.aggregate], column);
+    else
+      fprintf(stdout, "  %s(%s): over the tuples read\n", names[options.aggregate], column);
+  }
+  if (options.orderAttr != 0 && attr != 4 && options.aggregate == SelectOptions::NONE) {
+    const char* column = (options.orderAttr == 1) ? "key" : "value";
+    const char* dir = options.desc ? " desc" : "";
+    if (indexOrder && options.orderAttr == 1)
+      fprintf(stdout, "  order by %s%s: %sindex order, no sorting\n", column, dir, options.desc ? "reverse " : "");
+    else if (options.limit >= 0)
+      fprintf(stdout, "  order by %s%s: top-%d heap\n", column, dir, options.limit);
+    else
+      fprintf(stdout, "  order by %s%s: sorted in memory\n", column, dir);
+  }
+  if (options.limit >= 0 && attr != 4 && options.aggregate == SelectOptions::NONE) {
+    bool sorted = (options.orderAttr == 2 || (options.orderAttr == 1 && !indexOrder));
+    fprintf(stdout, "  limit %d: %s\n", options.limit,
+      sorted ? "applied after sorting" : "the scan stops early");
+  }
+  if (plan.ranges.empty()) {
+    fprintf(stdout, "  key range: empty\n");
+  } else {
+    // print the first few key ranges only, IN lists can make many of them
+    fprintf(stdout, "  key %s:", plan.ranges.size() > 1 ? "ranges" : "range");
+    for (unsigned i = 0; i < plan.ranges.size() && i < 8; i++) {
+      fprintf(stdout, " [");
+      if (plan.ranges[i].first == INT_MIN) fprintf(stdout, "-inf"); else fprintf(stdout, "%d", plan.ranges[i].first);
+      fprintf(stdout, ", ");
+      if (plan.ranges[i].second == INT_MAX) fprintf(stdout, "+inf"); else fprintf(stdout, "%d", plan.ranges[i].second);
+      fprintf(stdout, "]");
+    }
+    if (plan.ranges.size() > 8)
+      fprintf(stdout, " ... (%d ranges)", (int)plan.ranges.size());
+    fprintf(stdout, "\n");
+    if (preds.size() > 1)
+      fprintf(stdout, "  conjunctions: %d\n", (int)preds.size());
+    if (preds.size() == 1 && !preds[0].excluded.empty()) {
+      fprintf(stdout, "  excluded keys:");
+      for (unsigned i = 0; i < preds[0].excluded.size(); i++)
+        fprintf(stdout, " %d", preds[0].excluded[i]);
+      fprintf(stdout, "\n");
+    }
+  }
+
+  // print the estimates that the choice was based on
+  TableStats stats;
+  if (plan.hasStats && stats.open(table) == 0) {
+    fprintf(stdout, "  statistics: %d tuples in %d pages, keys in [%d, %d], ~%.0f distinct keys, ~%.0f distinct values, average value length %.1f\n",
+      stats.getRowCount(), stats.getPageCount(), stats.getMinKey(), stats.getMaxKey(),
+      stats.getDistinctKeys(), stats.getDistinctValues(), stats.getAvgValueLength());
+  }
+  if (plan.method == AccessPlan::NO_SCAN) {
+    fprintf(stdout, "  estimated page reads: 0\n");
+  } else if (!plan.hasStats) {
+    fprintf(stdout, "  no statistics for table %s: plan picked by rules\n", table.c_str());
+    fprintf(stdout, "  estimated page reads: full scan %.0f\n", plan.scanCost);
+  } else {
+    fprintf(stdout, "  estimated tuples in key range: %.0f\n", plan.rows);
+    fprintf(stdout, "  estimated page reads: full scan %.0f", plan.scanCost);
+    if (plan.indexCost >= 0) fprintf(stdout, ", index %.0f", plan.indexCost);
+    fprintf(stdout, "\n");
+  }
+
+  if (indexExists) index.close();
+  rf.close();
+  return 0;
+}
+
+RC SqlEngine::analyze(const string& table)
+{
+  RecordFile rf;
+  TableStats stats;
+  RecordId   rid;
+  RC         rc;
+  int        key;
+  string     value;
+
+  if ((rc = rf.open(table + ".tbl", 'r')) < 0) {
+    fprintf(stderr, "Error: table %s does not exist\n", table.c_str());
+    return rc;
+  }
+
+  // rebuild the statistics from every tuple in the table
+  for (rid.pid = rid.sid = 0; rid < rf.endRid(); ++rid) {
+    if ((rc = rf.read(rid, key, value)) < 0) {
+      rf.close();
+      return rc;
+    }
+    stats.add(key, value);
+  }
+
+  const RecordId& end = rf.endRid();
+  rc = stats.save(table, end.pid + (end.sid > 0 ? 1 : 0));
+  rf.close();
+  return rc;
+}
+
+// compile the conditions of a WHERE clause: parse the constants of the
+// key conditions and fold them into the range [low, high] minus a sorted
+// list of excluded keys. contradicting conditions (e.g., key = 1 and
+// key = 2, or key > 5 and key < 6) leave no key and mark pred as empty.
+void compilePredicate(const vector<SelCond>& conds, Predicate& pred)
+{
+    vector<int> ne;
+
+    pred.empty = false;
+    pred.low = INT_MIN;
+    pred.high = INT_MAX;
+    pred.excluded.clear();
+    pred.valueConds.clear();
+
+    for (unsigned i = 0; i < conds.size(); i++) {
+        if (conds[i].attr != 1) {
+            pred.valueConds.push_back(conds[i]);
+            continue;
+        }
+        int v = atoi(conds[i].value);
+        switch (conds[i].comp) {
+            case SelCond::EQ:
+                if (v > pred.low) pred.low = v;
+                if (v < pred.high) pred.high = v;
                 break;
-                case SelCond::NE:  temp.push_back(conds[i]);
+            case SelCond::NE:
+                ne.push_back(v);
                 break;
-                case SelCond::GT:
-                case SelCond::GE: 
-                    if (!lowerBoundAdded) {
-                        temp.push_back(conds[i]);
-                        lowerBoundAdded = true;
-                    }
+            case SelCond::GT:
+                if (v == INT_MAX) pred.empty = true;
+                else if (v + 1 > pred.low) pred.low = v + 1;
                 break;
-                case SelCond::LT:
-                case SelCond::LE:
-                    if (!upperBoundAdded) {
-                        temp.push_back(conds[i]);
-                        upperBoundAdded = true;
-                    }
+            case SelCond::GE:
+                if (v > pred.low) pred.low = v;
+                break;
+            case SelCond::LT:
+                if (v == INT_MIN) pred.empty = true;
+                else if (v - 1 < pred.high) pred.high = v - 1;
+                break;
+            case SelCond::LE:
+                if (v < pred.high) pred.high = v;
                 break;
-            }
         }
     }
-    
-    //cout << "filterConds: testing6" << endl;
-    // swap temporary vector with input vector
-    conds.swap(temp);
-   
-/* 
-    for (int i = 0; i < conds.size(); i++) {
-        cout << i << " key ";
-        switch (conds[i].comp) {
-            case SelCond::NE: cout << "!="; break;
-            case SelCond::EQ: cout << "=="; break;
-            case SelCond::LT: cout << "<"; break;
-            case SelCond::LE: cout << "<="; break;
-            case SelCond::GT: cout << ">"; break;
-            case SelCond::GE: cout << ">="; break;
+    if (pred.low > pred.high)
+        pred.empty = true;
+    if (pred.empty)
+        return;
+
+    // keep the excluded keys inside the range, and shrink the range
+    // while one of its ends is excluded
+    sort(ne.begin(), ne.end());
+    ne.erase(unique(ne.begin(), ne.end()), ne.end());
+    vector<int>::iterator first = lower_bound(ne.begin(), ne.end(), pred.low);
+    vector<int>::iterator last = upper_bound(first, ne.end(), pred.high);
+    while (first != last && *first == pred.low) {
+        if (pred.low == pred.high) {
+            pred.empty = true;
+            return;
         }
-        //cout << " " << conds[i].value << endl;
+        pred.low++;
+        first++;
     }
-    
- */   
-    // return whether range exists
-    return rangeExists;
+    while (first != last && *(last - 1) == pred.high) {
+        pred.high--;
+        last--;
+    }
+    pred.excluded.assign(first, last);
+}
+
+// check whether a key satisfies the key conditions of a compiled WHERE clause
+bool keySatisfiesPredicate(int key, const Predicate& pred)
+{
+    if (pred.empty || key < pred.low || key > pred.high)
+        return false;
+    return !binary_search(pred.excluded.begin(), pred.excluded.end(), key);
+}
+
+// compile a WHERE clause in disjunctive normal form into one predicate
+// per conjunction. conjunctions that no tuple can satisfy are dropped, so
+// preds is empty if the WHERE clause can never be true.
+void compileWhere(const vector<vector<SelCond> >& conds, vector<Predicate>& preds)
+{
+    Predicate pred;
+
+    preds.clear();
+    for (unsigned i = 0; i < conds.size(); i++) {
+        compilePredicate(conds[i], pred);
+        if (pred.empty)
+            continue;
+
+        // a conjunction without conditions makes the others irrelevant
+        if (conds[i].empty()) {
+            preds.assign(1, pred);
+            return;
+        }
+        preds.push_back(pred);
+    }
+}
+
+// collect the key ranges of all predicates, sorted by their lower bound,
+// merging the ranges that overlap or touch each other
+void getKeyRanges(const vector<Predicate>& preds, vector<KeyRange>& ranges)
+{
+    vector<KeyRange> all;
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (!preds[i].empty)
+            all.push_back(KeyRange(preds[i].low, preds[i].high));
+    sort(all.begin(), all.end());
+
+    ranges.clear();
+    for (unsigned i = 0; i < all.size(); i++) {
+        if (!ranges.empty() && (ranges.back().second == INT_MAX || all[i].first <= ranges.back().second + 1)) {
+            if (all[i].second > ranges.back().second)
+                ranges.back().second = all[i].second;
+        } else {
+            ranges.push_back(all[i]);
+        }
+    }
+}
+
+// check whether a key satisfies the key conditions of any conjunction
+bool keySatisfiesWhere(int key, const vector<Predicate>& preds)
+{
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (keySatisfiesPredicate(key, preds[i]))
+            return true;
+    return false;
+}
+
+// check whether a tuple satisfies all conditions of any conjunction
+bool tupleSatisfiesWhere(int key, string& value, const vector<Predicate>& preds)
+{
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (keySatisfiesPredicate(key, preds[i]) && valueSatisfiesConds(value, preds[i].valueConds))
+            return true;
+    return false;
+}
+
+// check the value conditions against the value prefixes of a zone: a
+// condition rules the zone out only if the prefixes alone decide it
+static bool zoneValuesMayMatch(const ZoneMap::Zone& zone, const vector<SelCond>& conds)
+{
+    char prefix[ZoneMap::PREFIX_LENGTH];
+    for (unsigned i = 0; i < conds.size(); i++) {
+        ZoneMap::makePrefix(conds[i].value, ZoneMap::PREFIX_LENGTH, prefix);
+        bool belowMin = memcmp(prefix, zone.minValue, ZoneMap::PREFIX_LENGTH) < 0;
+        bool aboveMax = memcmp(prefix, zone.maxValue, ZoneMap::PREFIX_LENGTH) > 0;
+        switch (conds[i].comp) {
+            case SelCond::EQ:  if (belowMin || aboveMax) return false;
+            break;
+            case SelCond::GT:
+            case SelCond::GE:  if (aboveMax) return false;
+            break;
+            case SelCond::LT:
+            case SelCond::LE:  if (belowMin) return false;
+            break;
+            case SelCond::NE:
+            break;
+        }
+    }
+    return true;
+}
+
+// true if some tuple summarized by a zone (or a group of zones) may
+// satisfy the WHERE clause
+static bool summaryMayMatch(const ZoneMap::Zone& z, const vector<Predicate>& preds)
+{
+    for (unsigned i = 0; i < preds.size(); i++) {
+        if (preds[i].low > z.maxKey || preds[i].high < z.minKey)
+            continue;
+        if (z.minKey == z.maxKey && binary_search(preds[i].excluded.begin(), preds[i].excluded.end(), z.minKey))
+            continue;
+        if (zoneValuesMayMatch(z, preds[i].valueConds))
+            return true;
+    }
+    return false;
+}
+
+// true if some tuple of a zone of a table may satisfy the WHERE clause,
+// judging by the summary of the group of the zone and then by that of the
+// zone itself. a zone that the zone map does not summarize, or any zone
+// when a conjunction has no condition at all, may always match.
+bool zoneMayMatch(const ZoneMap& zones, int zone, const vector<Predicate>& preds)
+{
+    ZoneMap::Zone z;
+    if (zone >= zones.getZoneCount())
+        return true;
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (preds[i].low == INT_MIN && preds[i].high == INT_MAX && preds[i].excluded.empty() && preds[i].valueConds.empty())
+            return true;
+    if (zones.getGroup(zone, z) == 0 && !summaryMayMatch(z, preds))
+        return false;
+    if (zones.getZone(zone, z) < 0)
+        return true;
+    return summaryMayMatch(z, preds);
+}
+
+// pick the cheapest way of evaluating a SELECT statement.
+// the cost of an access path is the estimated number of page reads:
+//   full scan:        # pages in the table (the key pages, and the value
+//                     pages if the values are needed, of a columnar table)
+//   index-only scan:  (height - 1) internal nodes + leaves in the key range
+//   index scan:       index-only scan + one page read per matching tuple
+// if there are no statistics for the table, the index is used whenever
+// there is a key condition other than <> (or no condition at all for
+// SELECT key and SELECT COUNT(*)), or for ORDER BY key with a LIMIT.
+// an index scan in key order (ascending or descending) with a LIMIT and
+// no value conditions stops after LIMIT entries, so its cost is scaled
+// down accordingly.
+void choosePlan(int attr, const string& table, const vector<Predicate>& preds, const SelectOptions& options, const RecordFile& rf, BTreeIndex* idx, AccessPlan& plan)
+{
+    TableStats stats;
+    bool needTuples = (attr == 2 || attr == 3 || options.orderAttr == 2);
+    bool keyRangeGiven = true;
+    bool unconditional = false;
+    bool stopEarly = (options.orderAttr != 2 && options.limit >= 0 && attr != 4);
+
+    // the index narrows the search only if every conjunction bounds the key
+    for (unsigned i = 0; i < preds.size(); i++) {
+        bool bounded = (preds[i].low != INT_MIN || preds[i].high != INT_MAX);
+        if (!preds[i].valueConds.empty())
+            needTuples = true, stopEarly = false;
+        if (!bounded)
+            keyRangeGiven = false;
+        if (!bounded && preds[i].excluded.empty() && preds[i].valueConds.empty())
+            unconditional = true;
+    }
+
+    getKeyRanges(preds, plan.ranges);
+    const RecordId& end = rf.endRid();
+    double tuples = (double)end.pid * RecordFile::RECORDS_PER_PAGE + end.sid;
+    plan.scanCost = end.pid + (end.sid > 0 ? 1 : 0);
+    plan.indexCost = -1;
+
+    // the statistics are stale if tuples were added since they were saved,
+    // even if the tuples did not take a new page
+    plan.hasStats = (stats.open(table) == 0 && stats.getRowCount() == tuples);
+
+    // the tuples in the key ranges: the whole table without statistics
+    plan.rows = plan.hasStats ? 0 : tuples;
+    for (unsigned i = 0; i < plan.ranges.size() && plan.hasStats; i++)
+        plan.rows += stats.estimateRows(plan.ranges[i].first, plan.ranges[i].second);
+
+    // a scan of a columnar table reads the value pages only if it needs
+    // the values
+    if (rf.isColumnar())
+        plan.scanCost = rf.getZoneCount() + (needTuples ? rf.getValuePageCount() : 0);
+    plan.method = AccessPlan::FULL_SCAN;
+
+    // contradicting conditions: there is nothing to read
+    if (preds.empty()) {
+        plan.hasStats = false;
+        plan.rows = 0;
+        plan.method = AccessPlan::NO_SCAN;
+        return;
+    }
+
+    // SELECT COUNT(*) without conditions is answered by the statistics
+    if (plan.hasStats && attr == 4 && unconditional) {
+        plan.rows = stats.getRowCount();
+        plan.method = AccessPlan::STATS_COUNT;
+        return;
+    }
+
+    if (idx == NULL)
+        return;
+
+    AccessPlan::Method indexMethod = needTuples ? AccessPlan::INDEX_SCAN : AccessPlan::INDEX_ONLY;
+
+    if (!plan.hasStats) {
+        if (keyRangeGiven || (unconditional && !needTuples) || (stopEarly && options.orderAttr == 1))
+            plan.method = indexMethod;
+        return;
+    }
+
+    // the ranges are read in one pass over the leaves, so a leaf is read
+    // once even if several ranges fall on it. the leaves of a range are
+    // found from the position of its ends in the key distribution.
+    double rowCount = stats.getRowCount();
+    int    leafCount = idx->getLeafCount();
+    int    lastLeaf = -1;
+    double leaves = 0;
+    for (unsigned i = 0; i < plan.ranges.size() && rowCount > 0; i++) {
+        double before = 0;
+        if (plan.ranges[i].first != INT_MIN)
+            before = stats.estimateRows(INT_MIN, plan.ranges[i].first - 1);
+        double rows = stats.estimateRows(plan.ranges[i].first, plan.ranges[i].second);
+        int first = (int)(before / rowCount * leafCount);
+        int last = (int)((before + rows) / rowCount * leafCount);
+        if (last >= leafCount) last = leafCount - 1;
+        if (first <= lastLeaf) first = lastLeaf + 1;
+        if (last >= first) {
+            leaves += last - first + 1;
+            lastLeaf = last;
+        }
+    }
+    double fetched = plan.rows;
+    if (stopEarly && plan.rows > options.limit) {
+        leaves *= options.limit / plan.rows;
+        fetched = options.limit;
+    }
+    if (leaves < 1)
+        leaves = 1;
+
+    plan.indexCost = (idx->getTreeHeight() - 1) + leaves;
+    if (needTuples)
+        plan.indexCost += ceil(fetched);
+
+    if (plan.indexCost <= plan.scanCost)
+        plan.method = indexMethod;
 }
 
 bool valueSatisfiesConds(string& value, const vector<SelCond>& conds) {
@@ -501,404 +1423,731 @@ bool valueSatisfiesConds(string& value, const vector<SelCond>& conds) {
 }
 
 
-//finds all of the rid's in the index satisfying the first condition on keys
-void getRidsFirstCond(SelCond condition, BTreeIndex& idx, set<IndexEntry>& resultsToCheck) {    
-    IndexCursor cursor;
-    RecordId rid;
-    int keyInIndex;
-	IndexEntry idxEntry;
-	bool continueLoop;
-	RC error;
-    int valueToComp = atoi(condition.value);
-	//cout << "value to compare with is " << valueToComp << endl;   
- 
-    switch(condition.comp) {
-      //equality condition - look up directly in index
-      case (SelCond::EQ):
-        //cout << "checking on equality of key with " << valueToComp << endl;
-        if (idx.locate(valueToComp, cursor)!=0) {
-          //cout << "on equality check, locate failed to find key greater than or equal to " << valueToComp << endl;
-          return;
-        }
-        if (idx.readForward(cursor, keyInIndex, rid)!=0) {
-          //cout << "readForward in check on equality failed" << endl;
-          return;
-        }
-        if (valueToComp == keyInIndex){
-          //cout << "found value for key " << valueToComp << " in index, adding rid to resultsToCheck" << endl;
-          idxEntry.rid = rid;
-		  idxEntry.key = keyInIndex;
-		  resultsToCheck.insert(idxEntry);
-        }
-        else {
-          //cout << "in comparing for equality, key not found in index" << endl;
-          return;
-        }
-        return;  
-  
-      //Greater than or greater than or equal condition
-      case (SelCond::GT):
-      case (SelCond::GE):
-        if (idx.locate(valueToComp, cursor) != 0) {
-          //cerr << "no key in index found with key > or >= " << valueToComp << endl;
-          return;
-        }
+// # key ranges whose starts are located in one batch: the leaves that a
+// batch falls on must still be in the page cache when the ranges are read
+static const int RANGE_BATCH = 4;
 
-		//check first value for GE or GT condition
-		error = idx.readForward(cursor, keyInIndex, rid);
-		//cout << "first result found is rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-
-        if ((condition.comp==SelCond::GE && keyInIndex>=valueToComp) || (condition.comp==SelCond::GT && keyInIndex>valueToComp)){ 
-          //cout << "inserting into resultsToCheck rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-          idxEntry.rid = rid;
-          idxEntry.key = keyInIndex;
-		  resultsToCheck.insert(idxEntry);
-        }
-        
-		if (error !=0 )   //the retrieved key was the last one in the tree - we're done
-			return;
-
-		//more to read - read through remaining rid's in index, with keys greater than current location
-        continueLoop = true;
-		while (continueLoop) {
-				error = idx.readForward(cursor, keyInIndex, rid); 
-          		//cout << "inserting into resultsToCheck rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-          		idxEntry.rid = rid;
-          		idxEntry.key = keyInIndex;
-		 	 	resultsToCheck.insert(idxEntry);
-				if (error != 0)
-					continueLoop = false;
+// read the index entries whose keys satisfy the key conditions of any of
+// preds, in key order. ranges are the sorted, disjoint key ranges of preds.
+// the starts of the ranges are located in batches that share the descent
+// from the root, so a leaf that several ranges fall on is read only once.
+// the scan stops after limit entries (-1: no limit).
+void getRidsInRanges(const vector<Predicate>& preds, const vector<KeyRange>& ranges, BTreeIndex& idx, int limit, vector<IndexEntry>& results)
+{
+    vector<int>         lows;
+    vector<IndexCursor> cursors;
+    IndexEntry          entry;
+    RC                  rc;
+
+    // a key in the ranges satisfies some predicate unless <> excludes it
+    bool checkKeys = false;
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (!preds[i].excluded.empty())
+            checkKeys = true;
+
+    for (unsigned i = 0; i < ranges.size(); i++) {
+        if (i % RANGE_BATCH == 0) {
+            lows.clear();
+            for (unsigned j = i; j < ranges.size() && j < i + RANGE_BATCH; j++)
+                lows.push_back(ranges[j].first);
+            if (idx.locateBatch(lows, cursors) != 0)
+                return;
         }
-        return;
-
+        IndexCursor& cursor = cursors[i % RANGE_BATCH];
+
+        // no more keys >= low in the index
+        if (cursor.pid == -1)
+            return;
+
+        // read the entries from low up to high
+        do {
+            rc = idx.readForward(cursor, entry.key, entry.rid);
+            if (rc != 0 && rc != RC_END_OF_TREE)
+                return;
+            if (entry.key > ranges[i].second)
+                break;
+            if (!checkKeys || keySatisfiesWhere(entry.key, preds))
+                results.push_back(entry);
+            if (limit >= 0 && (int)results.size() >= limit)
+                return;
+        } while (rc == 0);
+    }
+}
 
-      //Less than or less than or equal condition
-      case (SelCond::LT):
-      case (SelCond::LE):
-        //cout << "checking on LT or LE condition on key compared to " << valueToComp << endl;
-        IndexCursor stoppingCursor;
-                  
-        //looking for first position in index
-        if (idx.locate(0, cursor) != 0) {
-          //cerr << "no \"smallest\" key found in index" << endl;
-          return;
-        }
-        //cout << "cursor of start is (pageId: " << cursor.pid << ", eid: " << cursor.eid << ")" << endl;
-
-        //look for stopping position
-        if (idx.locate(valueToComp, stoppingCursor) != 0) {
-           	//cout << "all keys in index less than " << valueToComp << " - will add all rid's to resultsToCheck" << endl;
-            continueLoop = true;
-			while (continueLoop) {
-				error = idx.readForward(cursor, keyInIndex, rid);
-            	//cout << "inserting into resultsToCheck rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-            	idxEntry.rid = rid;
-				idxEntry.key = keyInIndex;
-				resultsToCheck.insert(idxEntry);
-				if (error != 0)
-					continueLoop = false;
-          	}
-			return;
-        }
 
-        else {
-          //cout << "reading all keys up until stopping cursor: (PageID: " << stoppingCursor.pid << ", eid: " << stoppingCursor.eid << ")" << endl; 
-          //read all keys up until stopping point
-          IndexCursor nextCursor;
-          nextCursor.pid = cursor.pid;
-          nextCursor.eid = cursor.eid;
-          while (idx.readForward(nextCursor, keyInIndex, rid)==0){
-            //cout << "reading forward - reading cursor (pageId: " << cursor.pid << ", eid: " << cursor.eid << ")" << endl;
-            if (cursor.pid!=stoppingCursor.pid || cursor.eid!=stoppingCursor.eid) {
-              //cout << "inserting into resultsToCheck rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-              idxEntry.rid = rid;
-	 		  idxEntry.key = keyInIndex;
-			  resultsToCheck.insert(idxEntry);
-              cursor.pid = nextCursor.pid;
-              cursor.eid = nextCursor.eid;
-            }
-            else {
-              if (condition.comp==SelCond::LE and keyInIndex==valueToComp) {
-                //cout << "condition is LE, and key with value " << valueToComp << " is in index - including in resultsToCheck" << endl;
-                idxEntry.rid = rid;
-				idxEntry.key = keyInIndex;
-				resultsToCheck.insert(idxEntry);       
-              }
-   			  break;
-			}
-		  }
-		return;
-	   }
-
-	}  
-}
-
-void getRidsInRange(SelCond& lowerBound, SelCond& upperBound, BTreeIndex& idx, set<IndexEntry>& resultsToCheck){
+// read the index entries of getRidsInRanges() in descending key order:
+// every range is read from its high end to its low end, walking the
+// leaves backward, starting with the last range.
+void getRidsInRangesBackward(const vector<Predicate>& preds, const vector<KeyRange>& ranges, BTreeIndex& idx, int limit, vector<IndexEntry>& results)
+{
     IndexCursor cursor;
-	IndexCursor nextCursor;
-    RecordId rid;
-    int keyInIndex;
-    IndexEntry idxEntry;
-    bool continueLoop;
-	RC error;
-	bool firstIteration;
-    int valueToCompLow = atoi(lowerBound.value);
-	int valueToCompHigh = atoi(upperBound.value);
-
-    if (TESTING) cout << "getRidsInRange: starting function" << endl;
-
-	//find cursor for lower bound
-    if (TESTING) cout << "getRidsInRange: locate on lower bound" << endl;
-	error = idx.locate(valueToCompLow, cursor);
-	
-	//if error - lower bound is too high for index, no tuples to return
-	if (error != 0) {
-// 		cout << "lower bound is too high, no tuples to return " << endl;
-		return;
-	}
-
-	//find cursor for upper bound
-    if (TESTING) cout << "getRidsInRange: locate on upper bound" << endl;
-	IndexCursor stoppingCursor;
-	error = idx.locate(valueToCompHigh, stoppingCursor);
-	
-	//if error - upper bound exceeds values in index - will read forward to the end
-	if (error !=0) {
-// 		cout << "upper bound exceeds values in index - will read forward to the end" << endl;
-		continueLoop = true;
-		firstIteration = true;
-        if (TESTING) cout << "getRidsInRange: testing 628" << endl;
-        while (continueLoop) {
-        if (TESTING) cout << "getRidsInRange: testing 630" << endl;
-           error = idx.readForward(cursor, keyInIndex, rid);
-           //cout << "inserting into resultsToCheck rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-           if (firstIteration) {
-        if (TESTING) cout << "getRidsInRange: testing 634" << endl;
-                if ((lowerBound.comp==SelCond::GE && keyInIndex>=valueToCompLow) || (lowerBound.comp==SelCond::GT && keyInIndex>valueToCompLow)){
-                        if (TESTING) cout << "getRidsInRange: testing 636" << endl;
-                    idxEntry.rid = rid;
-                    idxEntry.key = keyInIndex;
-                    resultsToCheck.insert(idxEntry);            
-                }
-                firstIteration = false;
-           }
-           else {
-                   if (TESTING) cout << "getRidsInRange: testing 644" << endl;
-                idxEntry.rid = rid;
-                idxEntry.key = keyInIndex;
-                resultsToCheck.insert(idxEntry);
-           }
-		   if (error !=0)
-				continueLoop = false;
-		}
-		return;
-	}
-
-	//otherwise, will read up until stopping cursor
- 	else {		
- 	    if (TESTING) cout << "getRidsInRange: testing 657" << endl;
-		continueLoop = true;
-		firstIteration = true;
-		nextCursor.eid = cursor.eid;
-		nextCursor.pid = cursor.pid;
-
-		//loop through all values - if first iteration, check whether include lower bound
-    	while (continueLoop) {
- 	    if (TESTING) cout << "getRidsInRange: testing 665" << endl;
-	    	//read in value
-	    	if (TESTING) cout << "getRidsInRange: starting readForward" << endl;
-       		error = idx.readForward(nextCursor, keyInIndex, rid);
-	    	if (TESTING) cout << "getRidsInRange: done with readForward" << endl;
- 	    if (TESTING) cout << "getRidsInRange: testing 668" << endl;
-			//on first iteration, consider whether to include lower bound or not
-			if (firstIteration && cursor.pid != stoppingCursor.pid || cursor.eid != stoppingCursor.eid) {
-			 	    if (TESTING) cout << "getRidsInRange: testing 671" << endl;
-                if ((lowerBound.comp==SelCond::GE && keyInIndex>=valueToCompLow) || (lowerBound.comp==SelCond::GT && keyInIndex>valueToCompLow)){
-                    idxEntry.rid = rid;
-                    idxEntry.key = keyInIndex;
-                    resultsToCheck.insert(idxEntry);
-   			 	    if (TESTING) cout << "getRidsInRange: testing 676" << endl;
-                }
-                firstIteration = false;
-				cursor.pid = nextCursor.pid;
-				cursor.eid = nextCursor.eid;
-           	}
-           	else if (cursor.pid!=stoppingCursor.pid || cursor.eid!=stoppingCursor.eid) {
-           	   		if (TESTING) cout << "getRidsInRange: testing 681" << endl;
-              	//cout << "inserting into resultsToCheck rid (" << rid.pid << "," << rid.sid <<") with key " << keyInIndex << endl;
-              		idxEntry.rid = rid;
-              		idxEntry.key = keyInIndex;
-              		resultsToCheck.insert(idxEntry);
-              		cursor.pid = nextCursor.pid;
-              		cursor.eid = nextCursor.eid;
-			}
-		
-			//have reached stopping condition- check whether to include upper bound
-			else {
-                if (TESTING) cout << "getRidsInRange: testing 692" << endl;
-				if (upperBound.comp==SelCond::LE and keyInIndex==valueToCompHigh) {
-                if (TESTING) cout << "getRidsInRange: testing 694" << endl;
-                //cout << "condition is LE, and key with value " << valueToComp << " is in index - including in resultsToCheck" << endl;
-        	        idxEntry.rid = rid;
-            	    idxEntry.key = keyInIndex;
-                	resultsToCheck.insert(idxEntry);
-				}
-				continueLoop = false;
-			}
-		}
+    IndexEntry  entry;
+    RC          rc;
+
+    bool checkKeys = false;
+    for (unsigned i = 0; i < preds.size(); i++)
+        if (!preds[i].excluded.empty())
+            checkKeys = true;
+
+    for (int i = ranges.size() - 1; i >= 0; i--) {
+        // no more keys <= high in the index
+        if (idx.locateBackward(ranges[i].second, cursor) != 0)
+            return;
+
+        // read the entries from high down to low
+        do {
+            rc = idx.readBackward(cursor, entry.key, entry.rid);
+            if (rc != 0 && rc != RC_END_OF_TREE)
+                return;
+            if (entry.key < ranges[i].first)
+                break;
+            if (!checkKeys || keySatisfiesWhere(entry.key, preds))
+                results.push_back(entry);
+            if (limit >= 0 && (int)results.size() >= limit)
+                return;
+        } while (rc == 0);
     }
-    
-    if (TESTING) cout << "getRidsInRange: exiting function" << endl;
 }
 
-// filters a given keys with given conditions in place
-void filterKeys(const vector<SelCond>& conds, set<IndexEntry>& results)
+
+RC SqlEngine::linearScan(int attr, RecordFile &rf, const vector<Predicate>& preds, const SelectOptions& options)
 {
-    // return immediately if no conditions to check
-    if (conds.empty())
-      return;
+  RC     rc;
+  int    n;
+  int    keys[RecordFile::MAX_ZONE_RECORDS];
+  string values[RecordFile::MAX_ZONE_RECORDS];
+  ResultSet results;
 
-    int key, diff;
-    set<IndexEntry> temp;
+  // the tuples are in load order: ORDER BY always sorts them
+  initResults(results, attr, options, false);
 
-    // scan through all IndexEntrys in results
-    for (set<IndexEntry>::iterator it = results.begin(); it != results.end(); it++) {  
-        key = (*it).key;
-    
-        // check the key against every condition
-        for (int i = 0; i < conds.size(); i++) {
-    
-            // compute the difference between the key value and the condition value
-            diff = key - atoi(conds[i].value);
+  // the values are not read if the query does not refer to them
+  SelectOptions scan;
+  bool keysOnly = !scanReadsValues(getScanOptions(attr, options, scan), scan, preds);
 
-            // skip the key if any condition is not met
-            switch (conds[i].comp) {
-                case SelCond::EQ:  if (diff != 0) goto next_key;
-                break;
-                case SelCond::NE:  if (diff == 0) goto next_key;
-                break;
-                case SelCond::GT:  if (diff <= 0) goto next_key;
-                break;
-                case SelCond::LT:  if (diff >= 0) goto next_key;
-                break;
-                case SelCond::GE:  if (diff < 0)  goto next_key;
-                break;
-                case SelCond::LE:  if (diff > 0)  goto next_key;
-                break;
-            }
-        }
+  // a table of more than one morsel is scanned on the thread pool
+  if (threadCount > 1 && rf.getZoneCount() >= MORSEL_PAGES) {
+    if ((rc = parallelScan(results, rf, preds, keysOnly)) < 0)
+      goto exit_select;
+    return flushResults(results);
+  }
+
+  // scan the table file zone by zone from the beginning, skipping the
+  // zones whose summary rules out every tuple
+  for (int zone = 0; zone < rf.getZoneCount(); zone++) {
+    if (!zoneMayMatch(rf.getZoneMap(), zone, preds))
+      continue;
+    if (keysOnly)
+      rc = rf.readZoneKeys(zone, n, keys);
+    else
+      rc = rf.readZone(zone, n, keys, values);
+    if (rc < 0)
+      goto exit_select;
 
-        // all conditions are met -- add IndexEntry to temp set
-        temp.insert(*it);
+    for (int i = 0; i < n; i++) {
+      // skip the tuple if any condition is not met
+      if (!tupleSatisfiesWhere(keys[i], values[i], preds))
+        continue;
 
-        // move to the next IndexEntry
-        next_key:;
+      // the condition is met for the tuple. print it, or keep it for
+      // sorting. stop when LIMIT tuples are printed
+      if (!addResult(results, keys[i], values[i]))
+        return flushResults(results);
     }
-    
-    results.swap(temp);
+  }
+
+  // print the sorted tuples, or the matching tuple count if "select count(*)"
+  return flushResults(results);
+
+  // drop the held-back tuples and return
+  exit_select:
+  delete results.groups;
+  return rc;
 }
 
+void SqlEngine::setThreads(int threads)
+{
+  if (threads < 1)
+    threads = 1;
+  if (threads == threadCount)
+    return;
+  delete threadPool;
+  threadPool = NULL;
+  threadCount = threads;
+}
 
-RC SqlEngine::linearScan(int attr, RecordFile &rf, const vector<SelCond>& cond)
+int SqlEngine::getThreads()
 {
-  RecordId   rid;  // record cursor for table scanning
+  return threadCount;
+}
 
-  RC     rc;
-  int    key;     
-  string value;
-  int    count;
-  int    diff;
+void SqlEngine::setOutputFormat(ResultSink::Format format)
+{
+  output.setFormat(format);
+}
 
-  // scan the table file from the beginning
-  rid.pid = rid.sid = 0;
-  count = 0;
-  while (rid < rf.endRid()) {
-    // read the tuple
-    if ((rc = rf.read(rid, key, value)) < 0) {
-      //fprintf(stderr, "Error: while reading a tuple from table in linearScan\n");
-      goto exit_select;
-    }
+void SqlEngine::setIndexCompression(bool compressed)
+{
+  compressIndex = compressed;
+}
 
-    // check the conditions on the tuple
-    for (unsigned i = 0; i < cond.size(); i++) {
-      // compute the difference between the tuple value and the condition value
-      switch (cond[i].attr) {
-      case 1:
-	diff = key - atoi(cond[i].value);
-	break;
-      case 2:
-	diff = strcmp(value.c_str(), cond[i].value);
-	break;
-      }
+void SqlEngine::setTableStorage(RecordFile::Storage storage)
+{
+  tableStorage = storage;
+}
 
-      // skip the tuple if any condition is not met
-      switch (cond[i].comp) {
-      case SelCond::EQ:
-	if (diff != 0) goto next_tuple;
-	break;
-      case SelCond::NE:
-	if (diff == 0) goto next_tuple;
-	break;
-      case SelCond::GT:
-	if (diff <= 0) goto next_tuple;
-	break;
-      case SelCond::LT:
-	if (diff >= 0) goto next_tuple;
-	break;
-      case SelCond::GE:
-	if (diff < 0) goto next_tuple;
-	break;
-      case SelCond::LE:
-	if (diff > 0) goto next_tuple;
-	break;
+// LOAD reads the load file in chunks of about LOAD_CHUNK bytes that end
+// at a line break. a regular file is memory-mapped and its lines are
+// parsed in place; other files (pipes, the output of a decompressor, or
+// the command input) are read into a buffer. a file in the binary batch
+// format is read in chunks of whole batches instead. the chunks are
+// parsed on the thread pool, at most MORSELS_AHEAD chunks per worker
+// thread ahead of the one whose tuples are written to the table. the
+// index entries of up to LOAD_INDEX_BUFFER tuples are buffered. a new
+// index is built bottom-up: a full buffer is sorted and written to a
+// temporary file as a run, and the runs are merged into the leaves at
+// the end of the load, reading INDEX_RUN_READ entries of a run at a
+// time. the entries of an index that is not empty are inserted in key
+// order whenever the buffer is full.
+static const int LOAD_CHUNK = 1 << 20;
+static const int LOAD_INDEX_BUFFER = 1 << 20;
+static const int INDEX_RUN_READ = 1 << 14;
+
+// a load file that is read chunk by chunk
+typedef struct {
+  FILE*       file;
+  bool        pipe;    // true if file is the output of a decompressor
+  bool        stream;  // true if file is the command input, whose rows end
+                       // at a line with only "\." (read line by line)
+  bool        binary;  // true if the file is in the batch format
+  const char* map;     // the mapped file (NULL if it is read with fread)
+  size_t      size;    // the size of the mapped file
+  size_t      offset;  // the start of the next chunk in the mapped file
+  string      carry;   // fread: the part of the line that the last read ended in
+  vector<char> buffer; // fread: the buffer of a read
+  char*       line;    // stream: the buffer of getline()
+  size_t      lineSize;
+  bool        eof;     // stream and binary: true once the last tuple has been read
+} LoadFile;
+
+// the decompressors and compressors of compressed files, by file name suffix
+static const char* const COMPRESSORS[][3] = {
+  { ".gz",  "gzip -dc",  "gzip -c" },
+  { ".bz2", "bzip2 -dc", "bzip2 -c" },
+  { ".xz",  "xz -dc",    "xz -c" },
+  { ".zst", "zstd -dc",  "zstd -c" },
+};
+
+// the chunks of a load file that are being parsed
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t  done;  // signaled when a chunk is parsed
+} LoadPipeline;
+
+// a chunk of a load file and its parsed tuples
+typedef struct {
+  LoadPipeline* pipeline;
+  bool        binary;      // true if the chunk holds batches, not lines
+  string      text;        // fread: the lines of the chunk
+  const char* begin;       // the lines of the chunk without the last
+  const char* end;         // line break, in the map or in text
+  bool        done;        // true once the chunk is parsed (under pipeline->lock)
+  RC          rc;          // RC_INVALID_FILE_FORMAT if a line could not be parsed
+  vector<RecordRef> tuples;  // the tuples of the lines up to the bad one,
+                             // whose values point into the chunk
+} LoadChunk;
+
+// read an integer from [s, end) as atoi() does: white space, a sign and
+// digits. a value out of the range of long is clamped as in strtol()
+static int scanInt(const char* s, const char* end)
+{
+  while (s < end && isspace((unsigned char)*s)) s++;
+  bool negative = false;
+  if (s < end && (*s == '-' || *s == '+'))
+    negative = (*s++ == '-');
+  unsigned long n = 0;
+  unsigned long max = negative ? (unsigned long)LONG_MAX + 1 : LONG_MAX;
+  for (; s < end && *s >= '0' && *s <= '9'; s++) {
+    unsigned d = *s - '0';
+    n = (n > (max - d) / 10) ? max : n * 10 + d;
+  }
+  return (int)(negative ? -(long)(n - 1) - 1 : (long)n);
+}
+
+// parse a line of a load file in place, with the same rules as
+// SqlEngine::parseLoadLine(). the value is returned as a pointer into
+// the line and its length.
+// @param s[IN] the start of the line
+// @param end[IN] the end of the line (without the line break)
+// @param key[OUT] the key field of the tuple in the line
+// @param value[OUT] the start of the value field
+// @param length[OUT] the length of the value field
+// @return error code. 0 if no error
+static RC scanLoadLine(const char* s, const char* end, int& key, const char*& value, int& length)
+{
+  // ignore beginning white spaces
+  while (s < end && (*s == ' ' || *s == '\t')) s++;
+
+  // get the integer key value
+  key = scanInt(s, end);
+
+  // look for comma
+  s = (const char*)memchr(s, ',', end - s);
+  if (s == NULL) return RC_INVALID_FILE_FORMAT;
+
+  // ignore white spaces
+  do { s++; } while (s < end && (*s == ' ' || *s == '\t'));
+
+  // the value runs to the closing quote if it is delimited by ' or ",
+  // and to the end of the line otherwise
+  const char* last = end;
+  if (s < end && (*s == '\'' || *s == '"')) {
+    char quote = *s++;
+    last = (const char*)memchr(s, quote, end - s);
+    if (last == NULL) last = end;
+  }
+  value = s;
+  length = last - s;
+  return 0;
+}
+
+// parse the lines of a text chunk
+static void parseLines(LoadChunk* chunk)
+{
+  RecordRef tuple;
+
+  const char* line = chunk->begin;
+  for (;;) {
+    const char* end = (const char*)memchr(line, '\n', chunk->end - line);
+    if (end == NULL) end = chunk->end;
+    if ((chunk->rc = scanLoadLine(line, end, tuple.key, tuple.value, tuple.length)) != 0)
+      break;
+    chunk->tuples.push_back(tuple);
+    if (end == chunk->end)
+      break;
+    line = end + 1;
+  }
+}
+
+// parse a chunk on a worker thread
+static void parseChunk(void* arg)
+{
+  LoadChunk* chunk = (LoadChunk*)arg;
+
+  if (chunk->binary) {
+    chunk->rc = BatchFormat::decode(chunk->begin, chunk->end, chunk->tuples);
+  } else {
+    chunk->rc = 0;
+    parseLines(chunk);
+  }
+
+  pthread_mutex_lock(&chunk->pipeline->lock);
+  chunk->done = true;
+  pthread_cond_broadcast(&chunk->pipeline->done);
+  pthread_mutex_unlock(&chunk->pipeline->lock);
+}
+
+// the entry of COMPRESSORS for the suffix of a file name, -1 if none
+static int findCompressor(const string& name)
+{
+  for (unsigned i = 0; i < sizeof(COMPRESSORS) / sizeof(COMPRESSORS[0]); i++) {
+    string suffix = COMPRESSORS[i][0];
+    if (name.size() > suffix.size() &&
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+      return i;
+  }
+  return -1;
+}
+
+// a shell command that runs a (de)compressor on a file
+static string compressorCommand(const char* program, const char* redirect, const string& name)
+{
+  // quote the file name for the shell
+  string command = string(program) + " " + redirect + "'";
+  for (unsigned j = 0; j < name.size(); j++) {
+    if (name[j] == '\'') command += "'\\''";
+    else command += name[j];
+  }
+  command += "'";
+  return command;
+}
+
+// open a load file: map it if it is a regular file, and read it through
+// a decompressor if its name has the suffix of a compressed file
+static RC openLoadFile(const string& name, LoadFile& lf)
+{
+  struct stat st;
+  char        magic[BatchFormat::MAGIC_SIZE];
+
+  lf.pipe = lf.stream = lf.binary = lf.eof = false;
+  lf.map = NULL;
+  lf.line = NULL;
+  lf.size = lf.offset = lf.lineSize = 0;
+
+  int c = findCompressor(name);
+  if (c >= 0) {
+    // the decompressor would only complain on its own
+    if (access(name.c_str(), R_OK) != 0)
+      return RC_FILE_OPEN_FAILED;
+    string command = compressorCommand(COMPRESSORS[c][1], "", name);
+    if ((lf.file = popen(command.c_str(), "r")) == NULL)
+      return RC_FILE_OPEN_FAILED;
+    lf.pipe = true;
+  } else {
+    if ((lf.file = fopen(name.c_str(), "r")) == NULL)
+      return RC_FILE_OPEN_FAILED;
+
+    if (fstat(fileno(lf.file), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(lf.file), 0);
+      if (map != MAP_FAILED) {
+        madvise(map, st.st_size, MADV_SEQUENTIAL);
+        lf.map = (const char*)map;
+        lf.size = st.st_size;
+        if (lf.size >= (size_t)BatchFormat::MAGIC_SIZE && BatchFormat::isBatchFile(lf.map)) {
+          lf.binary = true;
+          lf.offset = BatchFormat::MAGIC_SIZE;
+        }
+        return 0;
       }
     }
+  }
+
+  // a file that is read with fread is a batch file if it starts with the
+  // magic bytes. otherwise they are the start of its first line
+  lf.buffer.resize(LOAD_CHUNK);
+  size_t n = fread(magic, 1, sizeof(magic), lf.file);
+  if (n == sizeof(magic) && BatchFormat::isBatchFile(magic))
+    lf.binary = true;
+  else
+    lf.carry.assign(magic, n);
+  return 0;
+}
+
+// read the rows that follow a LOAD command on the command input
+static void openLoadStream(FILE* input, LoadFile& lf)
+{
+  lf.file = input;
+  lf.pipe = lf.binary = lf.eof = false;
+  lf.stream = true;
+  lf.map = NULL;
+  lf.line = NULL;
+  lf.size = lf.offset = lf.lineSize = 0;
+}
 
-    // the condition is met for the tuple. 
-    // increase matching tuple counter
-    count++;
+// close a load file. returns RC_FILE_READ_FAILED if its decompressor failed
+static RC closeLoadFile(LoadFile& lf)
+{
+  free(lf.line);
+  if (lf.stream)
+    return 0;
+  if (lf.pipe)
+    return (pclose(lf.file) == 0) ? 0 : RC_FILE_READ_FAILED;
+  if (lf.map != NULL)
+    munmap((void*)lf.map, lf.size);
+  fclose(lf.file);
+  return 0;
+}
 
-    // print the tuple 
-    switch (attr) {
-    case 1:  // SELECT key
-      fprintf(stdout, "%d\n", key);
+// read the next chunk of the rows on the command input. the command
+// input is read one line at a time so that nothing after the line with
+// "\." is taken away from the commands that follow it
+static LoadChunk* readStreamChunk(LoadFile& lf)
+{
+  if (lf.eof)
+    return NULL;
+
+  LoadChunk* chunk = new LoadChunk;
+  while (chunk->text.size() < (size_t)LOAD_CHUNK) {
+    ssize_t n = getline(&lf.line, &lf.lineSize, lf.file);
+    if (n <= 0) {
+      lf.eof = true;
       break;
-    case 2:  // SELECT value
-      fprintf(stdout, "%s\n", value.c_str());
+    }
+    ssize_t length = n;
+    while (length > 0 && (lf.line[length - 1] == '\n' || lf.line[length - 1] == '\r'))
+      length--;
+    if (length == 2 && lf.line[0] == '\\' && lf.line[1] == '.') {
+      lf.eof = true;
       break;
-    case 3:  // SELECT *
-      fprintf(stdout, "%d '%s'\n", key, value.c_str());
+    }
+    chunk->text.append(lf.line, n);
+    if (lf.line[n - 1] != '\n')
+      chunk->text += '\n';
+  }
+  if (chunk->text.empty()) {
+    delete chunk;
+    return NULL;
+  }
+
+  // the last line break is not part of the chunk
+  chunk->text.erase(chunk->text.size() - 1);
+  chunk->begin = chunk->text.data();
+  chunk->end = chunk->begin + chunk->text.size();
+  chunk->binary = false;
+  chunk->done = false;
+  return chunk;
+}
+
+// read the next chunk of a batch file: the batches that start in the
+// next LOAD_CHUNK bytes. a batch that is cut off by the end of the file
+// is left for BatchFormat::decode() to report
+static LoadChunk* readBatchChunk(LoadFile& lf)
+{
+  unsigned count, size;
+
+  if (lf.eof)
+    return NULL;
+
+  LoadChunk* chunk = new LoadChunk;
+  chunk->binary = true;
+  chunk->done = false;
+
+  if (lf.map != NULL) {
+    size_t offset = lf.offset;
+    while (offset - lf.offset < (size_t)LOAD_CHUNK) {
+      if (lf.size - offset < (size_t)BatchFormat::HEADER_SIZE) {
+        offset = lf.size;
+        lf.eof = true;
+        break;
+      }
+      BatchFormat::readHeader(lf.map + offset, count, size);
+      offset += BatchFormat::HEADER_SIZE;
+      if (count == 0) {
+        lf.eof = true;
+        break;
+      }
+      offset += std::min((size_t)size, lf.size - offset);
+    }
+    chunk->begin = lf.map + lf.offset;
+    chunk->end = lf.map + offset;
+    lf.offset = offset;
+  } else {
+    string& text = chunk->text;
+    while (text.size() < (size_t)LOAD_CHUNK) {
+      char   header[BatchFormat::HEADER_SIZE];
+      size_t n = fread(header, 1, sizeof(header), lf.file);
+      text.append(header, n);
+      if (n < sizeof(header)) {
+        lf.eof = true;
+        break;
+      }
+      BatchFormat::readHeader(header, count, size);
+      if (count == 0) {
+        lf.eof = true;
+        break;
+      }
+      // read the batch in pieces, so that a bad size does not allocate
+      // more memory than the file has
+      while (size > 0 && !lf.eof) {
+        n = fread(&lf.buffer[0], 1, std::min((size_t)size, lf.buffer.size()), lf.file);
+        text.append(&lf.buffer[0], n);
+        size -= n;
+        if (n == 0) lf.eof = true;
+      }
+      if (lf.eof) break;
+    }
+    chunk->begin = text.data();
+    chunk->end = chunk->begin + text.size();
+  }
+
+  if (chunk->begin == chunk->end) {
+    delete chunk;
+    return NULL;
+  }
+  return chunk;
+}
+
+// read the next chunk of a load file. returns NULL at the end of the file
+static LoadChunk* readChunk(LoadFile& lf)
+{
+  LoadChunk* chunk;
+
+  if (lf.stream)
+    return readStreamChunk(lf);
+  if (lf.binary)
+    return readBatchChunk(lf);
+
+  if (lf.map != NULL) {
+    if (lf.offset >= lf.size)
+      return NULL;
+
+    // the chunk ends at the first line break after LOAD_CHUNK bytes, and
+    // the last one in front of the line break that ends the file
+    const char* begin = lf.map + lf.offset;
+    const char* end = lf.map + lf.size;
+    if (lf.map[lf.size - 1] == '\n')
+      end--;
+    if (end == begin)
+      return NULL;
+    if (lf.size - lf.offset > LOAD_CHUNK) {
+      const char* lb = (const char*)memchr(begin + LOAD_CHUNK, '\n', end - begin - LOAD_CHUNK);
+      if (lb != NULL) end = lb;
+    }
+    lf.offset = end - lf.map + 1;
+
+    chunk = new LoadChunk;
+    chunk->begin = begin;
+    chunk->end = end;
+    chunk->binary = false;
+    chunk->done = false;
+    return chunk;
+  }
+
+  // read until the carried-over text has a line break
+  string::size_type end;
+  while ((end = lf.carry.rfind('\n')) == string::npos) {
+    size_t n = fread(&lf.buffer[0], 1, lf.buffer.size(), lf.file);
+    if (n == 0) {
+      // the last line of the file has no line break
+      if (lf.carry.empty())
+        return NULL;
+      end = lf.carry.size();
       break;
     }
+    lf.carry.append(&lf.buffer[0], n);
+  }
 
-    // move to the next tuple
-    next_tuple:
-    ++rid;
+  chunk = new LoadChunk;
+  chunk->text.assign(lf.carry, 0, end);
+  lf.carry.erase(0, end + 1);
+  chunk->begin = chunk->text.data();
+  chunk->end = chunk->begin + chunk->text.size();
+  chunk->binary = false;
+  chunk->done = false;
+  return chunk;
+}
+
+// the sorted runs of the index entries of a load that builds a new index
+typedef struct {
+  bool   bulk;     // true if the index is built bottom-up
+  FILE*  file;     // the runs, one after another (NULL until the first one)
+  string name;     // the name of the file
+  vector<long> counts;  // the # entries of every run
+} IndexRuns;
+
+// one run of a merge of index runs, read INDEX_RUN_READ entries at a time
+typedef struct {
+  long next;   // the position of the next entry to read in the file
+  long left;   // the # entries of the run that are not read yet
+  unsigned pos;   // the next entry of the buffer
+  vector<pair<int, RecordId> > buffer;
+} IndexRunReader;
+
+// sort the buffered index entries and append them to the file of runs
+static RC writeIndexRun(IndexRuns& runs, vector<pair<int, RecordId> >& entries)
+{
+  char name[64];
+
+  if (runs.file == NULL) {
+    sprintf(name, ".index-%d.tmp", (int)getpid());
+    runs.name = name;
+    if ((runs.file = fopen(name, "w+b")) == NULL) return RC_FILE_OPEN_FAILED;
   }
+  if (fwrite(&entries[0], sizeof(entries[0]), entries.size(), runs.file) != entries.size())
+    return RC_FILE_WRITE_FAILED;
+  runs.counts.push_back(entries.size());
+  return 0;
+}
 
-  // print matching tuple count if "select count(*)"
-  if (attr == 4) {
-    fprintf(stdout, "%d\n", count);
+// read the next entries of a run into its buffer
+static RC readIndexRun(IndexRuns& runs, IndexRunReader& reader)
+{
+  long n = min(reader.left, (long)INDEX_RUN_READ);
+  reader.buffer.resize(n);
+  reader.pos = 0;
+  if (n == 0) return 0;
+  if (fseeko(runs.file, (off_t)reader.next * sizeof(reader.buffer[0]), SEEK_SET) != 0 ||
+      fread(&reader.buffer[0], sizeof(reader.buffer[0]), n, runs.file) != (size_t)n)
+    return RC_FILE_READ_FAILED;
+  reader.next += n;
+  reader.left -= n;
+  return 0;
+}
+
+// build a new index bottom-up from a merge of the runs in the file and
+// the sorted entries in the buffer, which are the last run. an entry of
+// an earlier run goes first among the entries of a key, so that they
+// stay in load order
+static RC mergeIndexRuns(BTreeIndex& idx, IndexRuns& runs, vector<pair<int, RecordId> >& entries)
+{
+  RC rc;
+  int count = runs.counts.size() + 1;
+  vector<IndexRunReader> readers(count);
+  vector<pair<int, int> > heap;  // the next key and the # of every run
+  greater<pair<int, int> > order;
+
+  long next = 0;
+  for (int i = 0; i < count - 1; i++) {
+    readers[i].next = next;
+    readers[i].left = runs.counts[i];
+    next += runs.counts[i];
+    if ((rc = readIndexRun(runs, readers[i])) < 0) return rc;
+  }
+  readers[count - 1].next = readers[count - 1].left = 0;
+  readers[count - 1].pos = 0;
+  readers[count - 1].buffer.swap(entries);
+  for (int i = 0; i < count; i++) {
+    if (!readers[i].buffer.empty())
+      heap.push_back(make_pair(readers[i].buffer[0].first, i));
+  }
+  make_heap(heap.begin(), heap.end(), order);
+
+  if ((rc = idx.startBulkLoad()) != 0) return rc;
+  while (!heap.empty()) {
+    pop_heap(heap.begin(), heap.end(), order);
+    IndexRunReader& reader = readers[heap.back().second];
+    const pair<int, RecordId>& entry = reader.buffer[reader.pos++];
+    if ((rc = idx.addBulkEntry(entry.first, entry.second)) != 0) return rc;
+    if (reader.pos == reader.buffer.size() && (rc = readIndexRun(runs, reader)) < 0) return rc;
+    if (reader.pos < reader.buffer.size()) {
+      heap.back().first = reader.buffer[reader.pos].first;
+      push_heap(heap.begin(), heap.end(), order);
+    } else {
+      heap.pop_back();
+    }
   }
-  rc = 0;
+  return idx.finishBulkLoad();
+}
 
-  // close the table file and return
-  exit_select:
+// write the buffered index entries to the index: insert them in key order
+// into an index that is not empty, and otherwise add them as a sorted run
+// to the runs of a new index, which is built from the runs at the end of
+// the load (last is true)
+static RC flushIndexEntries(BTreeIndex& idx, IndexRuns& runs, vector<pair<int, RecordId> >& entries, bool last)
+{
+  RC rc;
+
+  stable_sort(entries.begin(), entries.end(), IndexEntryOrder());
+  if (!runs.bulk) {
+    rc = 0;
+    for (unsigned i = 0; i < entries.size() && rc == 0; i++)
+      rc = idx.insert(entries[i].first, entries[i].second);
+  } else if (!last) {
+    rc = writeIndexRun(runs, entries);
+  } else if (runs.counts.empty()) {
+    rc = idx.bulkLoad(entries);
+  } else {
+    rc = mergeIndexRuns(idx, runs, entries);
+  }
+  entries.clear();
   return rc;
 }
 
-RC SqlEngine::load(const string& table, const string& loadfile, bool index)
+// remove the file of the runs of a load
+static void closeIndexRuns(IndexRuns& runs)
+{
+  if (runs.file == NULL) return;
+  fclose(runs.file);
+  unlink(runs.name.c_str());
+  runs.file = NULL;
+}
+
+// load the tuples of an open load file into a table
+static RC loadTuples(const string& table, LoadFile& loadFile, bool index)
 {
   string tableName = table + ".tbl";
   string indexName = table + ".idx";
-  
-  //open loadfile as fstream
-  ifstream loadStream;
-  loadStream.open(loadfile.c_str());
-  if (loadStream.fail()) {
-    //cerr << "Error opening loadfile." << endl;
-    return(RC_FILE_OPEN_FAILED);
-  }
+  RC rc = 0;
 
 
   //if table exists but index does not, don't create index
@@ -910,97 +2159,952 @@ RC SqlEngine::load(const string& table, const string& loadfile, bool index)
 
   //open RecordFile - if file does not already exist, is created 
   RecordFile records;
-  if (records.open(tableName, 'w')!=0) {
+  if (records.open(tableName, 'w', tableStorage)!=0) {
     //cerr << "Error opening record file." << endl;
     return(RC_FILE_OPEN_FAILED);
   }
   
   
+  //statistics are kept for tables that have been loaded with statistics
+  //from the start (a new table) - otherwise they would only cover part of it
+  TableStats stats;
+  bool newTable = (records.endRid().pid == 0 && records.endRid().sid == 0);
+  bool keepStats = (stats.open(table) == 0) || newTable;
+
+
   //open index file
   BTreeIndex idx;
   if (index) {
     if (idx.open(indexName, 'w') != 0) {
       //cerr << "Error opening index file." << endl;
+      records.close();
       return (RC_FILE_OPEN_FAILED);
     }
+    //a new index gets the leaf format of the current setting
+    if (idx.getTreeHeight() == 0 && (rc = idx.setCompressLeaves(compressIndex)) != 0) {
+      idx.close();
+      records.close();
+      return rc;
+    }
   }
 
 
-  //read in records from loadfile
-  string value, recordLine;
-  while (getline(loadStream, recordLine)) {
-    int key;
-    RecordId rid;
-    
-//    cout << "recordLine is " << recordLine << endl;    
+  //read in the load file chunk by chunk, parse the chunks in parallel,
+  //and write their tuples in file order
+  LoadPipeline pipeline;
+  pthread_mutex_init(&pipeline.lock, NULL);
+  pthread_cond_init(&pipeline.done, NULL);
 
-    //parse load line:
-    if (parseLoadLine(recordLine, key, value)!=0) {
-      //cerr << "Error parsing load line." <<endl ;
-      return(RC_INVALID_FILE_FORMAT);
-    }  
-    
-    //store in recordfile:
-    if (records.append(key, value, rid)!=0) {
+  ThreadPool* pool = (threadCount > 1) ? getThreadPool() : NULL;
+  unsigned ahead = pool ? pool->getWorkerCount() * MORSELS_AHEAD : 1;
+  deque<LoadChunk*> chunks;
+  string value;
+  bool eof = false;
+  vector<pair<int, RecordId> > indexEntries;
+  IndexRuns runs;
+  runs.bulk = (index && idx.getTreeHeight() == 0);
+  runs.file = NULL;
+
+  for (;;) {
+    // keep the pipeline full
+    while (!eof && chunks.size() < ahead) {
+      LoadChunk* chunk = readChunk(loadFile);
+      if (chunk == NULL) {
+        eof = true;
+        break;
+      }
+      chunk->pipeline = &pipeline;
+      chunks.push_back(chunk);
+      if (pool)
+        pool->submit(parseChunk, chunk);
+      else
+        parseChunk(chunk);
+    }
+    if (chunks.empty())
+      break;
+
+    // write the tuples of the oldest chunk once it is parsed
+    LoadChunk* chunk = chunks.front();
+    pthread_mutex_lock(&pipeline.lock);
+    while (!chunk->done)
+      pthread_cond_wait(&pipeline.done, &pipeline.lock);
+    pthread_mutex_unlock(&pipeline.lock);
+
+    //store in recordfile: the tuples of the chunk fill the pages in
+    //memory, and every page is written once
+    RecordId rid;
+    if (!chunk->tuples.empty() &&
+        records.appendBatch(&chunk->tuples[0], chunk->tuples.size(), rid) != 0) {
       //cerr<< "Error appending to records file." <<endl;
-      return(RC_FILE_WRITE_FAILED);
-    }
- 
-    //store in index if index is selected
-    if (index) {
-	  //cout << "key being inserted is " << key << endl;
-      if (idx.insert(key, rid)!=0) {
-        //cerr << "Error inserting value in index in SqlEngine.load()" << endl;
-        return(RC_FILE_WRITE_FAILED);
+      rc = RC_FILE_WRITE_FAILED;
+    }
+
+    for (unsigned i = 0; i < chunk->tuples.size() && rc == 0; i++, ++rid) {
+      const RecordRef& tuple = chunk->tuples[i];
+      int key = tuple.key;
+
+      //update the table statistics
+      if (keepStats) {
+        value.assign(tuple.value, tuple.length);
+        stats.add(key, value);
       }
-    }  
-  //  cout << "Storing line number " <<count << ": key-" << key << " | value-" << value << endl; 
+
+      //buffer the index entry if index is selected
+      if (index) {
+        indexEntries.push_back(make_pair(key, rid));
+        if (indexEntries.size() >= LOAD_INDEX_BUFFER &&
+            flushIndexEntries(idx, runs, indexEntries, false) != 0) {
+          //cerr << "Error inserting value in index in SqlEngine.load()" << endl;
+          rc = RC_FILE_WRITE_FAILED;
+          break;
+        }
+      }
+    }
+    if (rc == 0 && chunk->rc != 0) {
+      //cerr << "Error parsing load line." <<endl ;
+      rc = RC_INVALID_FILE_FORMAT;
+    }
+    chunks.pop_front();
+    delete chunk;
+    if (rc != 0)
+      break;
   }
-  
+
+  //wait for the chunks that are still being parsed after an error
+  pthread_mutex_lock(&pipeline.lock);
+  for (unsigned i = 0; i < chunks.size(); i++) {
+    while (!chunks[i]->done)
+      pthread_cond_wait(&pipeline.done, &pipeline.lock);
+    delete chunks[i];
+  }
+  pthread_mutex_unlock(&pipeline.lock);
+  pthread_cond_destroy(&pipeline.done);
+  pthread_mutex_destroy(&pipeline.lock);
+
+  //the tuples that were loaded are in the index, even after an error
+  if (index && flushIndexEntries(idx, runs, indexEntries, true) != 0 && rc == 0) {
+    //cerr << "Error inserting value in index in SqlEngine.load()" << endl;
+    rc = RC_FILE_WRITE_FAILED;
+  }
+  closeIndexRuns(runs);
+
+  //write the last page of the table
+  if (records.flush() != 0 && rc == 0) {
+    //cerr<< "Error appending to records file." <<endl;
+    rc = RC_FILE_WRITE_FAILED;
+  }
+
+  if (rc == 0 && keepStats) {
+    const RecordId& end = records.endRid();
+    if (stats.save(table, end.pid + (end.sid > 0 ? 1 : 0)) != 0) {
+      //cerr << "Error writing table statistics." << endl;
+      rc = RC_FILE_WRITE_FAILED;
+    }
+  }
+
   if (index)
     idx.close();
   records.close();
-  loadStream.close();
-  return 0;
+  return rc;
+}
+
+// tell the user why a load stopped. the tuples in front of the error
+// stay in the table and its index
+static void reportLoadError(const string& table, RC rc)
+{
+  const char* reason;
+  switch (rc) {
+  case RC_INVALID_FILE_FORMAT: reason = "a line is not a key,value pair"; break;
+  case RC_FILE_OPEN_FAILED:    reason = "cannot open the table or its index"; break;
+  case RC_FILE_READ_FAILED:    reason = "cannot read the load file to its end"; break;
+  default:                     reason = "cannot write the table or its index"; break;
+  }
+  fprintf(stderr, "Error: the load of table %s stopped: %s\n", table.c_str(), reason);
+}
+
+RC SqlEngine::load(const string& table, const string& loadfile, bool index)
+{
+  RC rc;
+
+  //open loadfile
+  LoadFile loadFile;
+  if (openLoadFile(loadfile, loadFile) != 0) {
+    fprintf(stderr, "Error: cannot open the load file %s\n", loadfile.c_str());
+    return(RC_FILE_OPEN_FAILED);
+  }
+
+  rc = loadTuples(table, loadFile, index);
+
+  //a compressed file that could not be decompressed to its end
+  if (closeLoadFile(loadFile) != 0 && rc == 0)
+    rc = RC_FILE_READ_FAILED;
+  if (rc != 0)
+    reportLoadError(table, rc);
+  return rc;
+}
+
+RC SqlEngine::load(const string& table, FILE* input, bool index)
+{
+  RC rc;
+
+  LoadFile loadFile;
+  openLoadStream(input, loadFile);
+  rc = loadTuples(table, loadFile, index);
+
+  //skip the rest of the rows if the load stopped at an error
+  LoadChunk* chunk;
+  while ((chunk = readStreamChunk(loadFile)) != NULL)
+    delete chunk;
+  closeLoadFile(loadFile);
+  if (rc != 0)
+    reportLoadError(table, rc);
+  return rc;
+}
+
+RC SqlEngine::copy(const string& table, const string& file)
+{
+  RecordFile rf;
+  BatchWriter writer;
+  FILE*      out;
+  RC         rc;
+  int        n;
+  int        keys[RecordFile::RECORDS_PER_PAGE];
+  string     values[RecordFile::RECORDS_PER_PAGE];
+
+  if ((rc = rf.open(table + ".tbl", 'r')) < 0) {
+    fprintf(stderr, "Error: table %s does not exist\n", table.c_str());
+    return rc;
+  }
+
+  // a file name with the suffix of a compressed file is written through
+  // the compressor
+  int c = findCompressor(file);
+  if (c >= 0) {
+    string command = compressorCommand(COMPRESSORS[c][2], "> ", file);
+    out = popen(command.c_str(), "w");
+  } else {
+    out = fopen(file.c_str(), "w");
+  }
+  if (out == NULL) {
+    fprintf(stderr, "Error: cannot write to %s\n", file.c_str());
+    rf.close();
+    return RC_FILE_OPEN_FAILED;
+  }
+
+  // write the tuples page by page in the order of the table
+  rc = writer.open(out);
+  const RecordId& end = rf.endRid();
+  for (PageId pid = 0; rc == 0 && (pid < end.pid || (pid == end.pid && end.sid > 0)); pid++) {
+    if ((rc = rf.readPage(pid, n, keys, values)) < 0)
+      break;
+    for (int i = 0; i < n && rc == 0; i++)
+      rc = writer.write(keys[i], values[i].data(), values[i].size());
+  }
+  if (rc == 0)
+    rc = writer.close();
+
+  if (c >= 0) {
+    if (pclose(out) != 0 && rc == 0) rc = RC_FILE_WRITE_FAILED;
+  } else {
+    if (fclose(out) != 0 && rc == 0) rc = RC_FILE_WRITE_FAILED;
+  }
+  if (rc < 0)
+    fprintf(stderr, "Error: cannot write to %s\n", file.c_str());
+  rf.close();
+  return rc;
 }
 
 RC SqlEngine::parseLoadLine(const string& line, int& key, string& value)
 {
-    const char *s;
-    char        c;
-    string::size_type loc;
-    
-    // ignore beginning white spaces
-    c = *(s = line.c_str());
-    while (c == ' ' || c == '\t') { c = *++s; }
+    const char* s;
+    int         length;
+    RC          rc;
 
-    // get the integer key value
-    key = atoi(s);
+    // the line ends at the first null character, as a C string would
+    const char* begin = line.c_str();
+    if ((rc = scanLoadLine(begin, begin + strlen(begin), key, s, length)) != 0)
+        return rc;
+    value.assign(s, length);
+    return 0;
+}
 
-    // look for comma
-    s = strchr(s, ',');
-    if (s == NULL) { return RC_INVALID_FILE_FORMAT; }
 
-    // ignore white spaces
-    do { c = *++s; } while (c == ' ' || c == '\t');
-    
-    // if there is nothing left, set the value to empty string
-    if (c == 0) { 
-        value.erase();
-        return 0;
+//---------------------------------- joins ----------------------------------
+
+// # outer tuples of a nested-loop join whose join values are sorted and
+// probed in the inner index together
+static const int JOIN_PROBE_BATCH = 256;
+
+// # bytes of tuples that a hash join keeps in memory. if the build side
+// is larger, both tables are partitioned to temporary files first
+static const int HASH_JOIN_MEMORY = 1 << 20;
+
+// the maximum # partitions of a hash join, and the maximum # times a
+// partition that is still too large is partitioned again
+static const int HASH_JOIN_PARTITIONS = 64;
+static const int HASH_JOIN_MAX_DEPTH = 3;
+
+// one input of a join: a table (or a partition of it), the conditions
+// on its tuples and the column it is joined on
+typedef struct {
+  RecordFile*       rf;
+  const Predicate*  pred;  // NULL if every tuple qualifies
+  int               attr;  // the joined column: 1 - key, 2 - value
+} JoinInput;
+
+// the result of a join
+typedef struct {
+  vector<pair<int, int> > columns;  // (table, attr) of the SELECT clause; empty for COUNT(*)
+  int count;                        // # joined tuples
+} JoinOutput;
+
+// a tuple in the hash table of a hash join
+typedef struct {
+  int       key;
+  string    value;
+  unsigned  hash;  // hash of the join value
+  int       next;  // the next tuple in the same bucket (-1 if none)
+} HashTuple;
+
+// join method picked by the planner
+typedef struct {
+  enum Method { NO_JOIN, NESTED_LOOP, HASH, MERGE } method;
+  int     inner;      // NESTED_LOOP: the table whose index is probed
+                      // HASH: the table that the hash table is built on
+  bool    spill;      // HASH: true if the build side may not fit in memory
+  bool    fetch[2];   // MERGE: true if the tuples of table i must be read
+  double  rows[2];    // estimated # qualifying tuples of each table
+  double  pages[2];   // # pages of each table
+  double  loopCost;   // estimated # page reads of the nested loop (-1 if not possible)
+  double  hashCost;   // estimated # page reads of the hash join
+  double  mergeCost;  // estimated # page reads of the merge join (-1 if not possible)
+} JoinPlan;
+
+// the value of the joined column of a tuple as a string. keys are compared
+// to values in their decimal form, so the key 7 joins with the value "7"
+static void getJoinValue(int attr, int key, const string& value, string& jv)
+{
+  char buf[16];
+  if (attr == 1) {
+    jv.assign(buf, ResultSink::formatInt(key, buf));
+  } else {
+    jv = value;
+  }
+}
+
+// convert a join value to a key. returns false if the value is not the
+// decimal form of any key, in which case it joins with no key
+static bool parseJoinKey(const string& jv, int& key)
+{
+  char buf[16];
+  if (jv.empty() || jv.size() > 11) return false;
+  long v = strtol(jv.c_str(), NULL, 10);
+  if (v < INT_MIN || v > INT_MAX) return false;
+  key = (int)v;
+  int length = ResultSink::formatInt(key, buf);
+  return jv.compare(0, string::npos, buf, length) == 0;
+}
+
+// FNV-1a hash of a join value; different seeds give independent hashes
+static unsigned hashJoinValue(const string& jv, unsigned seed)
+{
+  unsigned h = 2166136261u ^ (seed * 0x9e3779b9u);
+  for (unsigned i = 0; i < jv.size(); i++) {
+    h ^= (unsigned char)jv[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// read the tuple at rid and the tuples after it until one satisfies the
+// conditions of the input. rid is moved past the returned tuple.
+// returns RC_END_OF_TREE if there are no more qualifying tuples.
+static RC nextJoinTuple(const JoinInput& in, RecordId& rid, int& key, string& value)
+{
+  RC rc;
+  while (rid < in.rf->endRid()) {
+    if ((rc = in.rf->read(rid, key, value)) < 0) return rc;
+    ++rid;
+    if (in.pred == NULL ||
+        (keySatisfiesPredicate(key, *in.pred) && valueSatisfiesConds(value, in.pred->valueConds)))
+      return 0;
+  }
+  return RC_END_OF_TREE;
+}
+
+// print (or count) a joined tuple. keys[i] and values[i] are the key and
+// the value of the tuple from table i
+static void emitJoinTuple(JoinOutput& out, const int keys[2], const string* values[2])
+{
+  out.count++;
+  if (out.columns.empty()) return;
+
+  for (unsigned i = 0; i < out.columns.size(); i++) {
+    int t = out.columns[i].first;
+    if (out.columns[i].second == 1)
+      output.putInt(keys[t]);
+    else
+      output.putValue(values[t]->data(), values[t]->size(), out.columns.size() > 1);
+  }
+  output.endRow();
+}
+
+// index nested-loop join: for every qualifying tuple of the outer table,
+// look up the inner tuples whose key equals its join value. the outer
+// tuples are read in blocks and their join values are sorted, so that
+// the lookups of a block share the descent from the root and every
+// inner leaf is read about once per block.
+static RC nestedLoopJoin(JoinInput in[2], int inner, BTreeIndex& idx, JoinOutput& out)
+{
+  int         outer = 1 - inner;
+  RecordId    rid;
+  RC          rc = 0;
+  int         keys[2];
+  string      value, jv;
+  const string* values[2];
+
+  vector<pair<int, int> > probes;    // (probe key, index into block)
+  vector<int>             blockKeys;
+  vector<string>          blockValues;
+  vector<int>             lookups;
+  vector<IndexCursor>     cursors;
+  IndexEntry              entry;
+
+  rid.pid = rid.sid = 0;
+  while (rc == 0) {
+    // read a block of outer tuples whose join values can match a key
+    probes.clear();
+    blockKeys.clear();
+    blockValues.clear();
+    while (probes.size() < JOIN_PROBE_BATCH &&
+           (rc = nextJoinTuple(in[outer], rid, keys[outer], value)) == 0) {
+      int probe;
+      getJoinValue(in[outer].attr, keys[outer], value, jv);
+      if (!parseJoinKey(jv, probe)) continue;
+      probes.push_back(make_pair(probe, (int)blockKeys.size()));
+      blockKeys.push_back(keys[outer]);
+      blockValues.push_back(value);
     }
+    if (rc != 0 && rc != RC_END_OF_TREE) return rc;
+    sort(probes.begin(), probes.end());
+
+    // look up the distinct probe keys, a few at a time (see getRidsInRanges)
+    for (unsigned i = 0; i < probes.size(); ) {
+      lookups.clear();
+      unsigned j = i;
+      while (j < probes.size() && lookups.size() < RANGE_BATCH) {
+        if (lookups.empty() || lookups.back() != probes[j].first)
+          lookups.push_back(probes[j].first);
+        j++;
+      }
+      while (j < probes.size() && probes[j].first == lookups.back())
+        j++;
+      if ((rc = idx.locateBatch(lookups, cursors)) != 0) return rc;
+
+      for (unsigned k = 0; k < lookups.size(); k++) {
+        IndexCursor& cursor = cursors[k];
+        RC rc2 = (cursor.pid == -1) ? RC_END_OF_TREE : 0;
+
+        // every inner tuple with the probe key...
+        while (rc2 == 0) {
+          rc2 = idx.readForward(cursor, entry.key, entry.rid);
+          if (rc2 != 0 && rc2 != RC_END_OF_TREE) return rc2;
+          if (entry.key != lookups[k]) break;
+          RC rc3 = in[inner].rf->read(entry.rid, keys[inner], value);
+          if (rc3 < 0) return rc3;
+          if (in[inner].pred != NULL &&
+              (!keySatisfiesPredicate(keys[inner], *in[inner].pred) ||
+               !valueSatisfiesConds(value, in[inner].pred->valueConds)))
+            continue;
+
+          // ...joins with every outer tuple of the block with that key
+          values[inner] = &value;
+          for (; i < j && probes[i].first < lookups[k]; i++) ;
+          for (unsigned m = i; m < j && probes[m].first == lookups[k]; m++) {
+            keys[outer] = blockKeys[probes[m].second];
+            values[outer] = &blockValues[probes[m].second];
+            emitJoinTuple(out, keys, values);
+          }
+        }
+      }
+      i = j;
+    }
+  }
+  return 0;
+}
 
-    // is the value field delimited by ' or "?
-    if (c == '\'' || c == '"') {
-        s++;
-    } else {
-        c = '\n';
+// move a merge-join input to its next index entry. last is true if the
+// entry is the last one in the index, and valid becomes false past it.
+static RC nextMergeEntry(BTreeIndex& idx, IndexCursor& cursor, IndexEntry& entry, bool& last, bool& valid)
+{
+  if (last) {
+    valid = false;
+    return 0;
+  }
+  RC rc = idx.readForward(cursor, entry.key, entry.rid);
+  if (rc != 0 && rc != RC_END_OF_TREE) return rc;
+  last = (rc == RC_END_OF_TREE);
+  valid = true;
+  return 0;
+}
+
+// sort-merge join of two tables joined on their keys: the leaves of both
+// indexes are read in key order in lockstep, starting at the larger of the
+// two lower key bounds. the tuples are read only for the keys that match
+// on both sides, and only from the tables whose values are needed.
+static RC mergeJoin(JoinInput in[2], BTreeIndex* idx[2], const bool fetch[2], JoinOutput& out)
+{
+  IndexCursor cursor[2];
+  IndexEntry  entry[2];
+  bool        last[2], valid[2];
+  RC          rc;
+  int         keys[2];
+  const string* values[2];
+  vector<IndexEntry> run[2];
+  vector<int>        runKeys[2];
+  vector<string>     runValues[2];
+
+  int low = max(in[0].pred->low, in[1].pred->low);
+  int high = min(in[0].pred->high, in[1].pred->high);
+  if (low > high) return 0;
+
+  // no entry at or after low in an index: nothing joins
+  for (int i = 0; i < 2; i++) {
+    rc = idx[i]->locate(low, cursor[i]);
+    if (rc == RC_END_OF_TREE || rc == RC_NO_SUCH_RECORD) return 0;
+    if (rc != 0) return rc;
+    last[i] = false;
+    if ((rc = nextMergeEntry(*idx[i], cursor[i], entry[i], last[i], valid[i])) != 0) return rc;
+  }
+
+  while (valid[0] && valid[1] && entry[0].key <= high && entry[1].key <= high) {
+    // move the side with the smaller key forward
+    if (entry[0].key != entry[1].key) {
+      int i = (entry[0].key < entry[1].key) ? 0 : 1;
+      if ((rc = nextMergeEntry(*idx[i], cursor[i], entry[i], last[i], valid[i])) != 0) return rc;
+      continue;
     }
 
-    // get the value string
-    value.assign(s);
-    loc = value.find(c, 0);
-    if (loc != string::npos) { value.erase(loc); }
+    // collect the entries with the same key on both sides
+    int key = entry[0].key;
+    for (int i = 0; i < 2; i++) {
+      run[i].clear();
+      while (valid[i] && entry[i].key == key) {
+        run[i].push_back(entry[i]);
+        if ((rc = nextMergeEntry(*idx[i], cursor[i], entry[i], last[i], valid[i])) != 0) return rc;
+      }
+    }
+    if (!keySatisfiesPredicate(key, *in[0].pred) || !keySatisfiesPredicate(key, *in[1].pred))
+      continue;
 
-    return 0;
+    // only the key is needed from both sides: nothing else to read
+    if (!fetch[0] && !fetch[1] && out.columns.empty()) {
+      out.count += run[0].size() * run[1].size();
+      continue;
+    }
+
+    // read the tuples that are needed and check their values
+    for (int i = 0; i < 2; i++) {
+      runKeys[i].clear();
+      runValues[i].clear();
+      for (unsigned j = 0; j < run[i].size(); j++) {
+        string value;
+        if (fetch[i]) {
+          if ((rc = in[i].rf->read(run[i][j].rid, keys[i], value)) < 0) return rc;
+          if (!valueSatisfiesConds(value, in[i].pred->valueConds)) continue;
+        }
+        runKeys[i].push_back(key);
+        runValues[i].push_back(value);
+      }
+    }
+    for (unsigned a = 0; a < runKeys[0].size(); a++) {
+      for (unsigned b = 0; b < runKeys[1].size(); b++) {
+        keys[0] = keys[1] = key;
+        values[0] = &runValues[0][a];
+        values[1] = &runValues[1][b];
+        emitJoinTuple(out, keys, values);
+      }
+    }
+  }
+  return 0;
+}
+
+// partition both inputs of a hash join to temporary files by the hash of
+// their join values, and join the matching partitions
+static RC partitionedHashJoin(JoinInput in[2], int build, JoinOutput& out, int depth);
+
+// hash join: build a hash table on the join values of the build side, and
+// probe it with the tuples of the other side. if the build side does not
+// fit in HASH_JOIN_MEMORY, both sides are partitioned to disk first.
+static RC hashJoin(JoinInput in[2], int build, JoinOutput& out, int depth)
+{
+  int         probe = 1 - build;
+  RecordId    rid;
+  RC          rc;
+  int         keys[2];
+  string      value, jv;
+  const string* values[2];
+  vector<HashTuple> tuples;
+  HashTuple   t;
+  long        bytes = 0;
+
+  // read the build side into memory
+  rid.pid = rid.sid = 0;
+  while ((rc = nextJoinTuple(in[build], rid, t.key, t.value)) == 0) {
+    getJoinValue(in[build].attr, t.key, t.value, jv);
+    t.hash = hashJoinValue(jv, 0);
+    tuples.push_back(t);
+    bytes += sizeof(HashTuple) + t.value.size();
+    if (bytes > HASH_JOIN_MEMORY && depth < HASH_JOIN_MAX_DEPTH) {
+      tuples.clear();
+      return partitionedHashJoin(in, build, out, depth);
+    }
+  }
+  if (rc != RC_END_OF_TREE) return rc;
+  if (tuples.empty()) return 0;
+
+  // chain the tuples into the buckets of the hash table
+  unsigned buckets = 1;
+  while (buckets < 2 * tuples.size()) buckets <<= 1;
+  vector<int> heads(buckets, -1);
+  for (unsigned i = 0; i < tuples.size(); i++) {
+    unsigned b = tuples[i].hash & (buckets - 1);
+    tuples[i].next = heads[b];
+    heads[b] = i;
+  }
+
+  // probe the hash table with the tuples of the other side
+  string bjv;
+  rid.pid = rid.sid = 0;
+  while ((rc = nextJoinTuple(in[probe], rid, keys[probe], value)) == 0) {
+    getJoinValue(in[probe].attr, keys[probe], value, jv);
+    unsigned h = hashJoinValue(jv, 0);
+    values[probe] = &value;
+    for (int i = heads[h & (buckets - 1)]; i >= 0; i = tuples[i].next) {
+      if (tuples[i].hash != h) continue;
+      getJoinValue(in[build].attr, tuples[i].key, tuples[i].value, bjv);
+      if (bjv != jv) continue;
+      keys[build] = tuples[i].key;
+      values[build] = &tuples[i].value;
+      emitJoinTuple(out, keys, values);
+    }
+  }
+  return (rc == RC_END_OF_TREE) ? 0 : rc;
+}
+
+static RC partitionedHashJoin(JoinInput in[2], int build, JoinOutput& out, int depth)
+{
+  RC         rc = 0;
+  RecordId   rid, appended;
+  int        key;
+  string     value, jv;
+  char       name[64];
+
+  // enough partitions for a partition of the build side to fit in memory
+  const RecordId& end = in[build].rf->endRid();
+  long bytes = (long)(end.pid + 1) * PageFile::PAGE_SIZE;
+  int  parts = (int)(2 * bytes / HASH_JOIN_MEMORY) + 2;
+  if (parts > HASH_JOIN_PARTITIONS) parts = HASH_JOIN_PARTITIONS;
+
+  vector<RecordFile> files(2 * parts);
+  vector<string>     names(2 * parts);
+
+  // write the qualifying tuples of both sides to their partitions
+  for (int side = 0; side < 2 && rc == 0; side++) {
+    for (int p = 0; p < parts && rc == 0; p++) {
+      sprintf(name, ".join-%d-%d-%d-%d.tmp", (int)getpid(), depth, side, p);
+      names[side * parts + p] = name;
+      rc = files[side * parts + p].open(name, 'w');
+    }
+    rid.pid = rid.sid = 0;
+    while (rc == 0 && (rc = nextJoinTuple(in[side], rid, key, value)) == 0) {
+      getJoinValue(in[side].attr, key, value, jv);
+      int p = hashJoinValue(jv, depth + 1) % parts;
+      rc = files[side * parts + p].append(key, value, appended);
+    }
+    if (rc == RC_END_OF_TREE) rc = 0;
+  }
+
+  // join the matching partitions, building on the smaller one
+  for (int p = 0; p < parts && rc == 0; p++) {
+    JoinInput sub[2];
+    for (int side = 0; side < 2; side++) {
+      sub[side].rf = &files[side * parts + p];
+      sub[side].pred = NULL;
+      sub[side].attr = in[side].attr;
+    }
+    int b = (sub[1].rf->endRid() < sub[0].rf->endRid()) ? 1 : 0;
+    rc = hashJoin(sub, b, out, depth + 1);
+  }
+
+  for (int i = 0; i < 2 * parts; i++) {
+    files[i].close();
+    if (!names[i].empty()) unlink(names[i].c_str());
+  }
+  return rc;
+}
+
+// the table number of a column of a join query (-1 if its table is not joined)
+static int joinSide(const JoinQuery& query, const JoinColumn& column)
+{
+  if (column.table == query.table[0]) return 0;
+  if (column.table == query.table[1]) return 1;
+  return -1;
+}
+
+// resolve the table names in the columns of a join query to the table
+// numbers (0 or 1), and compile the conditions on each table
+static RC resolveJoin(const JoinQuery& query, int joinAttr[2], Predicate pred[2], vector<pair<int, int> >& columns)
+{
+  vector<SelCond> conds[2];
+
+  if (query.table[0] == query.table[1]) {
+    fprintf(stderr, "Error: joining table %s with itself is not supported\n", query.table[0].c_str());
+    return RC_INVALID_ATTRIBUTE;
+  }
+
+  int left = joinSide(query, query.joined[0]), right = joinSide(query, query.joined[1]);
+  if (left < 0 || right < 0 || left == right) {
+    fprintf(stderr, "Error: the join condition must compare a column of %s with a column of %s\n",
+      query.table[0].c_str(), query.table[1].c_str());
+    return RC_INVALID_ATTRIBUTE;
+  }
+  joinAttr[left] = query.joined[0].attr;
+  joinAttr[right] = query.joined[1].attr;
+
+  for (unsigned i = 0; i < query.conds.size(); i++) {
+    int side = joinSide(query, query.conds[i].column);
+    if (side < 0) {
+      fprintf(stderr, "Error: table %s is not in the FROM clause\n", query.conds[i].column.table.c_str());
+      return RC_INVALID_ATTRIBUTE;
+    }
+    SelCond c;
+    c.attr = query.conds[i].column.attr;
+    c.comp = query.conds[i].comp;
+    c.value = query.conds[i].value;
+    conds[side].push_back(c);
+  }
+
+  columns.clear();
+  for (unsigned i = 0; i < query.columns.size(); i++) {
+    int side = joinSide(query, query.columns[i]);
+    if (side < 0) {
+      fprintf(stderr, "Error: table %s is not in the FROM clause\n", query.columns[i].table.c_str());
+      return RC_INVALID_ATTRIBUTE;
+    }
+    columns.push_back(make_pair(side, query.columns[i].attr));
+  }
+
+  compilePredicate(conds[0], pred[0]);
+  compilePredicate(conds[1], pred[1]);
+  return 0;
+}
+
+// pick the join method with the fewest estimated page reads:
+//   index nested loop: the outer table + one leaf per outer tuple (at most
+//                      all leaves of the inner index) + one inner tuple
+//                      per outer tuple
+//   hash join:         both tables, three times if they must be partitioned
+//   merge join:        the leaves of both indexes in the joined key range +
+//                      one tuple per match from every table whose values
+//                      are needed
+// the nested loop is possible only if the inner table is joined on its
+// key and has an index (idx[i] != NULL), and the merge join only if both
+// tables are.
+static void chooseJoin(const JoinQuery& query, const RecordFile rf[2], BTreeIndex* idx[2], const Predicate pred[2], JoinPlan& plan)
+{
+  plan.method = JoinPlan::NO_JOIN;
+  plan.inner = 0;
+  plan.spill = false;
+  plan.loopCost = -1;
+  plan.mergeCost = -1;
+
+  // the tuples of a table are needed for its value conditions and columns
+  for (int i = 0; i < 2; i++)
+    plan.fetch[i] = !pred[i].valueConds.empty();
+  for (unsigned i = 0; i < query.columns.size(); i++)
+    if (query.columns[i].attr == 2 && joinSide(query, query.columns[i]) >= 0)
+      plan.fetch[joinSide(query, query.columns[i])] = true;
+
+  for (int i = 0; i < 2; i++) {
+    const RecordId& end = rf[i].endRid();
+    plan.pages[i] = end.pid + (end.sid > 0 ? 1 : 0);
+    plan.rows[i] = (double)end.pid * RecordFile::RECORDS_PER_PAGE + end.sid;
+
+    // narrow the estimate down with the statistics of the key range
+    TableStats stats;
+    if (!pred[i].empty && stats.open(query.table[i]) == 0 && stats.getRowCount() == plan.rows[i])
+      plan.rows[i] = stats.estimateRows(pred[i].low, pred[i].high);
+  }
+  plan.hashCost = plan.pages[0] + plan.pages[1];
+  if (pred[0].empty || pred[1].empty)
+    return;
+
+  // build on the smaller table
+  plan.method = JoinPlan::HASH;
+  plan.inner = (plan.pages[1] < plan.pages[0]) ? 1 : 0;
+  plan.spill = (plan.pages[plan.inner] * PageFile::PAGE_SIZE > HASH_JOIN_MEMORY);
+  if (plan.spill)
+    plan.hashCost *= 3;
+
+  for (int inner = 0; inner < 2; inner++) {
+    if (idx[inner] == NULL) continue;
+    int outer = 1 - inner;
+    double leaves = plan.rows[outer];
+    if (leaves > idx[inner]->getLeafCount())
+      leaves = idx[inner]->getLeafCount();
+    double cost = plan.pages[outer] + (idx[inner]->getTreeHeight() - 1) + leaves + plan.rows[outer];
+    if (plan.loopCost < 0 || cost < plan.loopCost) {
+      plan.loopCost = cost;
+      if (cost <= plan.hashCost) {
+        plan.method = JoinPlan::NESTED_LOOP;
+        plan.inner = inner;
+      }
+    }
+  }
+
+  if (idx[0] != NULL && idx[1] != NULL) {
+    double matches = min(plan.rows[0], plan.rows[1]);
+    plan.mergeCost = 0;
+    for (int i = 0; i < 2; i++) {
+      double tuples = (double)rf[i].endRid().pid * RecordFile::RECORDS_PER_PAGE + rf[i].endRid().sid;
+      double leaves = (tuples > 0) ? ceil(plan.rows[i] / tuples * idx[i]->getLeafCount()) : 1;
+      plan.mergeCost += (idx[i]->getTreeHeight() - 1) + (leaves < 1 ? 1 : leaves);
+      if (plan.fetch[i])
+        plan.mergeCost += matches;
+    }
+    double best = plan.hashCost;
+    if (plan.loopCost >= 0 && plan.loopCost < best)
+      best = plan.loopCost;
+    if (plan.mergeCost <= best)
+      plan.method = JoinPlan::MERGE;
+  }
+}
+
+// open the tables of a join, and the index of every table that is joined
+// on its key. indexes[i] is NULL if table i has no usable index.
+static RC openJoin(const JoinQuery& query, const int joinAttr[2], RecordFile rf[2], BTreeIndex idx[2], BTreeIndex* indexes[2])
+{
+  RC rc;
+  for (int i = 0; i < 2; i++) {
+    if ((rc = rf[i].open(query.table[i] + ".tbl", 'r')) < 0) {
+      fprintf(stderr, "Error: table %s does not exist\n", query.table[i].c_str());
+      if (i > 0) rf[0].close();
+      return rc;
+    }
+  }
+  for (int i = 0; i < 2; i++) {
+    indexes[i] = NULL;
+    if (joinAttr[i] == 1 && idx[i].open(query.table[i] + ".idx", 'r') == 0)
+      indexes[i] = &idx[i];
+  }
+  return 0;
+}
+
+static void closeJoin(RecordFile rf[2], BTreeIndex* indexes[2])
+{
+  for (int i = 0; i < 2; i++) {
+    if (indexes[i] != NULL) indexes[i]->close();
+    rf[i].close();
+  }
+}
+
+RC SqlEngine::join(const JoinQuery& query)
+{
+  RecordFile  rf[2];
+  BTreeIndex  idx[2];
+  BTreeIndex* indexes[2];
+  Predicate   pred[2];
+  int         joinAttr[2];
+  JoinOutput  out;
+  JoinPlan    plan;
+  RC          rc;
+
+  if ((rc = resolveJoin(query, joinAttr, pred, out.columns)) < 0) return rc;
+  if ((rc = openJoin(query, joinAttr, rf, idx, indexes)) < 0) return rc;
+  chooseJoin(query, rf, indexes, pred, plan);
+
+  JoinInput in[2];
+  for (int i = 0; i < 2; i++) {
+    in[i].rf = &rf[i];
+    in[i].pred = &pred[i];
+    in[i].attr = joinAttr[i];
+  }
+
+  out.count = 0;
+  switch (plan.method) {
+  case JoinPlan::NO_JOIN:
+    rc = 0;
+    break;
+  case JoinPlan::NESTED_LOOP:
+    rc = nestedLoopJoin(in, plan.inner, *indexes[plan.inner], out);
+    break;
+  case JoinPlan::HASH:
+    rc = hashJoin(in, plan.inner, out, 0);
+    break;
+  case JoinPlan::MERGE:
+    rc = mergeJoin(in, indexes, plan.fetch, out);
+    break;
+  }
+
+  // print matching tuple count if "select count(*)"
+  if (rc < 0)
+    fprintf(stderr, "Error: cannot read the tables %s and %s to the end of the join\n",
+      query.table[0].c_str(), query.table[1].c_str());
+  if (rc == 0 && out.columns.empty()) {
+    output.putInt(out.count);
+    output.endRow();
+  }
+  output.flush();
+
+  closeJoin(rf, indexes);
+  return rc;
+}
+
+RC SqlEngine::explainJoin(const JoinQuery& query)
+{
+  RecordFile  rf[2];
+  BTreeIndex  idx[2];
+  BTreeIndex* indexes[2];
+  Predicate   pred[2];
+  int         joinAttr[2];
+  vector<pair<int, int> > columns;
+  JoinPlan    plan;
+  RC          rc;
+
+  if ((rc = resolveJoin(query, joinAttr, pred, columns)) < 0) return rc;
+  if ((rc = openJoin(query, joinAttr, rf, idx, indexes)) < 0) return rc;
+  chooseJoin(query, rf, indexes, pred, plan);
+
+  const char* inner = query.table[plan.inner].c_str();
+  const char* outer = query.table[1 - plan.inner].c_str();
+  switch (plan.method) {
+  case JoinPlan::NO_JOIN:
+    fprintf(stdout, "  plan: no tuple can satisfy the conditions, nothing is read\n");
+    break;
+  case JoinPlan::NESTED_LOOP:
+    fprintf(stdout, "  plan: index nested-loop join, probing %s.idx with the tuples of %s\n", inner, outer);
+    break;
+  case JoinPlan::HASH:
+    fprintf(stdout, "  plan: hash join, building the hash table on %s%s\n", inner,
+      plan.spill ? " (partitioned to disk)" : "");
+    break;
+  case JoinPlan::MERGE:
+    fprintf(stdout, "  plan: merge join of %s.idx and %s.idx", query.table[0].c_str(), query.table[1].c_str());
+    for (int i = 0; i < 2; i++)
+      if (plan.fetch[i]) fprintf(stdout, ", fetching tuples from %s.tbl", query.table[i].c_str());
+    fprintf(stdout, "\n");
+    break;
+  }
+  if (plan.method != JoinPlan::NO_JOIN) {
+    fprintf(stdout, "  estimated tuples: %s %.0f, %s %.0f\n",
+      query.table[0].c_str(), plan.rows[0], query.table[1].c_str(), plan.rows[1]);
+    fprintf(stdout, "  estimated page reads: hash join %.0f", plan.hashCost);
+    if (plan.loopCost >= 0) fprintf(stdout, ", nested loop %.0f", plan.loopCost);
+    if (plan.mergeCost >= 0) fprintf(stdout, ", merge join %.0f", plan.mergeCost);
+    fprintf(stdout, "\n");
+  }
+
+  closeJoin(rf, indexes);
+  return 0;
 }
@@ -10,9 +10,11 @@
 #ifndef SQLENGINE_H
 #define SQLENGINE_H
 
+#include <cstdio>
 #include <vector>
 #include "Bruinbase.h"
 #include "RecordFile.h"
+#include "ResultSink.h"
 
 /**
  * data structure to represent a condition in the WHERE clause
@@ -23,6 +25,61 @@ struct SelCond {
   char* value;  // the value to compare
 };
 
+/**
+ * a WHERE clause compiled for execution. the constants of the conditions
+ * on the key column are parsed once and folded into the closed interval
+ * [low, high] minus the keys in excluded.
+ */
+struct Predicate {
+  bool empty;        // true if no tuple can satisfy the WHERE clause
+  int  low, high;    // a matching key is in [low, high]...
+  std::vector<int> excluded;        // ...and not in this sorted list
+  std::vector<SelCond> valueConds;  // conditions on the value column
+};
+
+/**
+ * the aggregate function and the GROUP BY, ORDER BY and LIMIT clauses of
+ * a SELECT statement
+ */
+struct SelectOptions {
+  // the aggregate function applied to the attribute in the SELECT clause
+  enum Aggregate { NONE, MIN, MAX, SUM, AVG } aggregate;
+  int  groupAttr;  // attribute in GROUP BY: 0 - none, 1 - key, 2 - value
+  bool showGroup;  // true if the GROUP BY attribute is printed in front of the aggregate
+  int  orderAttr;  // attribute in ORDER BY: 0 - none, 1 - key, 2 - value
+  bool desc;       // true if the order is descending
+  int  limit;      // the number in LIMIT (-1 if there is no LIMIT)
+};
+
+/**
+ * a column of one of the tables of a join, written as table.attr
+ */
+struct JoinColumn {
+  std::string table;  // the table name
+  int attr;           // attribute: 1 - key column,  2 - value column
+};
+
+/**
+ * data structure to represent a condition in the WHERE clause of a join
+ */
+struct JoinCond {
+  JoinColumn column;  // the column to compare
+  SelCond::Comparator comp;
+  char* value;        // the value to compare
+};
+
+/**
+ * data structure to represent a SELECT statement over two tables that
+ * are joined on the equality of one column of each table.
+ */
+struct JoinQuery {
+  std::string table[2];             // the tables in the FROM clause
+  JoinColumn  joined[2];            // the columns in "t1.attr = t2.attr"
+  std::vector<JoinCond> conds;      // the other conditions, ANDed together
+  std::vector<JoinColumn> columns;  // the SELECT clause (empty for COUNT(*))
+  bool valid;                       // false if the WHERE clause has an error
+};
+
 /**
  * the class that takes, parses, and executes the user commands.
  */
@@ -40,18 +97,98 @@ class SqlEngine {
 
   /**
    * executes a SELECT statement.
-   * all conditions in conds must be ANDed together.
+   * the WHERE clause is given in disjunctive normal form: the conditions
+   * in each conds[i] are ANDed together, and the conds[i]'s are ORed.
+   * a SELECT without WHERE clause has a single empty conds[0].
    * the result of the SELECT is printed on screen.
    * @param attr[IN] attribute in the SELECT clause
    * (1: key, 2: value, 3: *, 4: count(*))
    * @param table[IN] the table name in the FROM clause
-   * @param conds[IN] list of conditions in the WHERE clause
+   * @param conds[IN] conditions in the WHERE clause
+   * @param options[IN] the aggregate function over attr (SUM and AVG
+   * apply to the key only), and the GROUP BY, ORDER BY and LIMIT clauses.
+   * with GROUP BY, the aggregate (or COUNT(*)) is printed for every group,
+   * and ORDER BY can only be on the GROUP BY attribute
+   * @return error code. 0 if no error
+   */
+  static RC select(int attr, const std::string& table, const std::vector<std::vector<SelCond> >& conds, const SelectOptions& options);
+
+  /**
+   * prints the access path that select() picks for a SELECT statement
+   * and the estimated cost of every access path, without running it.
+   * @param attr[IN] attribute in the SELECT clause
+   * (1: key, 2: value, 3: *, 4: count(*))
+   * @param table[IN] the table name in the FROM clause
+   * @param conds[IN] conditions in the WHERE clause (see select())
+   * @param options[IN] the aggregate function and the GROUP BY, ORDER BY
+   * and LIMIT clauses (see select())
+   * @return error code. 0 if no error
+   */
+  static RC explain(int attr, const std::string& table, const std::vector<std::vector<SelCond> >& conds, const SelectOptions& options);
+
+  /**
+   * executes a SELECT statement that joins two tables.
+   * the joined tuples are printed on screen.
+   * @param query[IN] the tables, the join condition, the other
+   * conditions and the columns of the SELECT statement
    * @return error code. 0 if no error
    */
-  static RC select(int attr, const std::string& table, const std::vector<SelCond>& conds);
+  static RC join(const JoinQuery& query);
 
   /**
-   * load a table from a load file.
+   * prints the join method that join() picks for a query, without
+   * running it.
+   * @param query[IN] the SELECT statement over two tables
+   * @return error code. 0 if no error
+   */
+  static RC explainJoin(const JoinQuery& query);
+
+  /**
+   * rebuild the statistics of a table from its content.
+   * @param table[IN] the table name in the ANALYZE command
+   * @return error code. 0 if no error
+   */
+  static RC analyze(const std::string& table);
+
+  /**
+   * set the # threads that a query may use. a full table scan is split
+   * into morsels that are scanned on that many worker threads.
+   * @param threads[IN] the # threads (1 to run every query on the
+   * calling thread only)
+   */
+  static void setThreads(int threads);
+
+  /**
+   * @return the # threads that a query may use (by default, the # CPUs)
+   */
+  static int getThreads();
+
+  /**
+   * set the format that query results are printed in.
+   * @param format[IN] TEXT (the default), TSV or BINARY
+   */
+  static void setOutputFormat(ResultSink::Format format);
+
+  /**
+   * choose the leaf format of the indexes that LOAD ... WITH INDEX
+   * creates from now on. an existing index keeps its format.
+   * @param compressed[IN] true for compressed leaves (delta-encoded keys
+   * and bit-packed RecordIds), false for plain ones (the default)
+   */
+  static void setIndexCompression(bool compressed);
+
+  /**
+   * choose the storage of the tables that LOAD creates from now on.
+   * an existing table keeps its storage.
+   * @param storage[IN] plain (the default), compressed or columnar
+   * (see RecordFile::open())
+   */
+  static void setTableStorage(RecordFile::Storage storage);
+
+  /**
+   * load a table from a load file: a text file with a line per tuple, or
+   * a file in the binary batch format of COPY ... TO. a file whose name
+   * ends in .gz, .bz2, .xz or .zst is decompressed while it is read.
    * @param table[IN] the table name in the LOAD command
    * @param loadfile[IN] the file name of the load file
    * @param index[IN] true if "WITH INDEX" option was specified
@@ -59,6 +196,26 @@ class SqlEngine {
    */
   static RC load(const std::string& table, const std::string& loadfile, bool index);
 
+  /**
+   * load a table from the rows that follow the LOAD command on the
+   * command input, up to a line with only "\." or the end of the input.
+   * @param table[IN] the table name in the LOAD command
+   * @param input[IN] the command input
+   * @param index[IN] true if "WITH INDEX" option was specified
+   * @return error code. 0 if no error
+   */
+  static RC load(const std::string& table, FILE* input, bool index);
+
+  /**
+   * write the tuples of a table to a file in the binary batch format
+   * (see BatchFormat.h), which LOAD reads back. a file whose name ends
+   * in .gz, .bz2, .xz or .zst is compressed while it is written.
+   * @param table[IN] the table name in the COPY command
+   * @param file[IN] the name of the file
+   * @return error code. 0 if no error
+   */
+  static RC copy(const std::string& table, const std::string& file);
+
   /**
    * parse a line from the load file into the (key, value) pair.
    * @param line[IN] a line from a load file
@@ -70,7 +227,9 @@ class SqlEngine {
 
 	private:
 
-	static RC linearScan(int attr, RecordFile &rf, const std::vector<SelCond>& cond);
+	static RC selectTable(int attr, const std::string& table, const std::vector<std::vector<SelCond> >& conds, const SelectOptions& options);
+
+	static RC linearScan(int attr, RecordFile &rf, const std::vector<Predicate>& preds, const SelectOptions& options);
 
 };
 
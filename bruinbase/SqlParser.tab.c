@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -55,181 +57,440 @@
 /* Pure parsers.  */
 #define YYPURE 0
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
 
 /* Substitute the variable and function names.  */
-#define yyparse sqlparse
-#define yylex   sqllex
-#define yyerror sqlerror
-#define yylval  sqllval
-#define yychar  sqlchar
-#define yydebug sqldebug
-#define yynerrs sqlnerrs
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     SELECT = 258,
-     FROM = 259,
-     WHERE = 260,
-     LOAD = 261,
-     WITH = 262,
-     INDEX = 263,
-     QUIT = 264,
-     COUNT = 265,
-     AND = 266,
-     OR = 267,
-     COMMA = 268,
-     STAR = 269,
-     LF = 270,
-     INTEGER = 271,
-     STRING = 272,
-     ID = 273,
-     EQUAL = 274,
-     NEQUAL = 275,
-     LESS = 276,
-     LESSEQUAL = 277,
-     GREATER = 278,
-     GREATEREQUAL = 279
-   };
-#endif
-/* Tokens.  */
-#define SELECT 258
-#define FROM 259
-#define WHERE 260
-#define LOAD 261
-#define WITH 262
-#define INDEX 263
-#define QUIT 264
-#define COUNT 265
-#define AND 266
-#define OR 267
-#define COMMA 268
-#define STAR 269
-#define LF 270
-#define INTEGER 271
-#define STRING 272
-#define ID 273
-#define EQUAL 274
-#define NEQUAL 275
-#define LESS 276
-#define LESSEQUAL 277
-#define GREATER 278
-#define GREATEREQUAL 279
-
-
-
-
-/* Copy the first part of user declarations.  */
+#define yyparse         sqlparse
+#define yylex           sqllex
+#define yyerror         sqlerror
+#define yydebug         sqldebug
+#define yynerrs         sqlnerrs
+#define yylval          sqllval
+#define yychar          sqlchar
+
+/* First part of user prologue.  */
 #line 1 "SqlParser.y"
 
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <sys/times.h>
+#include <unistd.h>
 #include <climits>
 #include <string>
 #include "Bruinbase.h"
 #include "SqlEngine.h" 
 #include "PageFile.h"
+#include "ThreadPool.h"
 
 int  sqllex(void);  
+extern FILE* sqlin;
 void sqlerror(const char *str) { fprintf(stderr, "Error: %s\n", str); }
 extern "C" { int  sqlwrap() { return 1; } }
 
-static void runSelect(int attr, const char* table, const std::vector<SelCond>& conds)
-{
-  struct tms tmsbuf;
-  clock_t btime, etime;
-  int     bpagecnt, epagecnt;
+typedef std::vector<std::vector<SelCond> > Disjunction;
+
+static struct tms tmsbuf;
+static clock_t btime;
+static int     bpagecnt;
+static long    btaskcnt, bstealcnt, btasktime;
 
+static void startTimer()
+{
   btime = times(&tmsbuf);
   bpagecnt = PageFile::getPageReadCount();
-  SqlEngine::select(attr, table, conds);
-  etime = times(&tmsbuf);
-  epagecnt = PageFile::getPageReadCount();
+  btaskcnt = ThreadPool::getTaskCount();
+  bstealcnt = ThreadPool::getStealCount();
+  btasktime = ThreadPool::getTaskTime();
+}
+
+static void stopTimer()
+{
+  clock_t etime = times(&tmsbuf);
+  int     epagecnt = PageFile::getPageReadCount();
+  long    etaskcnt = ThreadPool::getTaskCount();
 
   fprintf(stderr, "  -- %.3f seconds to run the select command. Read %d pages\n", ((float)(etime - btime))/sysconf(_SC_CLK_TCK), epagecnt - bpagecnt);
+  if (etaskcnt > btaskcnt) {
+    fprintf(stderr, "  -- %ld tasks on %d threads (%ld stolen), %.3f seconds of task time\n", etaskcnt - btaskcnt, SqlEngine::getThreads(), ThreadPool::getStealCount() - bstealcnt, (ThreadPool::getTaskTime() - btasktime) / 1e6);
+  }
 }
 
+// the SELECT clause is encoded as (column << 8) | (function << 4) | attr:
+// column is the GROUP BY attribute in front of an aggregate (0 if none),
+// and function is the aggregate function numbered as in
+// SelectOptions::Aggregate
+static int selectAttr(int list)
+{
+  return list & 0xf;
+}
 
+// the aggregate function and the GROUP BY, ORDER BY and LIMIT clauses.
+// list is the SELECT clause, group is the attribute in GROUP BY (0 if
+// none), order is the attribute in ORDER BY, negative if the order is
+// descending (0 if there is no ORDER BY), and limit is -1 if there is no
+// LIMIT. returns false if the clauses do not fit together.
+static bool selectOptions(int list, int group, int order, int limit, SelectOptions& options)
+{
+  int attr = selectAttr(list);
+  int column = list >> 8;
+  options.aggregate = static_cast<SelectOptions::Aggregate>((list >> 4) & 0xf);
+  options.groupAttr = group;
+  options.showGroup = (column != 0);
+  options.orderAttr = (order < 0) ? -order : order;
+  options.desc = (order < 0);
+  options.limit = limit;
+
+  if (group == 0) {
+    if (column != 0) {
+      sqlerror("a column in front of an aggregate needs GROUP BY");
+      return false;
+    }
+    return true;
+  }
+  if (column != 0 && column != group) {
+    sqlerror("the column in front of the aggregate must be the GROUP BY attribute");
+    return false;
+  }
+  if (attr == 3 || (options.aggregate == SelectOptions::NONE && attr != 4 && attr != group)) {
+    sqlerror("with GROUP BY, select the GROUP BY attribute or an aggregate");
+    return false;
+  }
+  if (options.orderAttr != 0 && options.orderAttr != group) {
+    sqlerror("with GROUP BY, ORDER BY must be on the GROUP BY attribute");
+    return false;
+  }
+  return true;
+}
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
+static void runSelect(int list, const char* table, const Disjunction& conds, int group, int order, int limit)
+{
+  SelectOptions options;
+  if (!selectOptions(list, group, order, limit, options)) return;
+  startTimer();
+  SqlEngine::select(selectAttr(list), table, conds, options);
+  stopTimer();
+}
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+static void runExplain(int list, const char* table, const Disjunction& conds, int group, int order, int limit)
+{
+  SelectOptions options;
+  if (!selectOptions(list, group, order, limit, options)) return;
+  SqlEngine::explain(selectAttr(list), table, conds, options);
+}
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+// a join whose WHERE clause had an error is not run
+static void runJoin(const JoinQuery& query)
+{
+  if (!query.valid) return;
+  startTimer();
+  SqlEngine::join(query);
+  stopTimer();
+}
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 32 "SqlParser.y"
+static void runExplainJoin(const JoinQuery& query)
 {
-  int integer;
-  char* string;
-  SelCond* cond;
-  std::vector<SelCond>* conds;
+  if (!query.valid) return;
+  SqlEngine::explainJoin(query);
+}
+
+// complete the SELECT clause of a join: * selects all columns of both
+// tables, COUNT(*) none. returns false if attr is an unqualified column.
+static bool setJoinColumns(JoinQuery* query, int attr)
+{
+  if (attr > 4) {
+    sqlerror("aggregate functions are not supported in a join");
+    return false;
+  }
+  if (attr == 1 || attr == 2) {
+    sqlerror("ambiguous attribute in a join. use table.key or table.value");
+    return false;
+  }
+  query->columns.clear();
+  for (int i = 0; i < 2 && attr == 3; i++) {
+    JoinColumn c;
+    c.table = query->table[i];
+    c.attr = 1;
+    query->columns.push_back(c);
+    c.attr = 2;
+    query->columns.push_back(c);
+  }
+  return true;
+}
+
+// free a join query and its condition values
+static void freeJoin(JoinQuery* query)
+{
+  for (unsigned i = 0; i < query->conds.size(); i++) {
+    free(query->conds[i].value);
+  }
+  delete query;
+}
+
+static JoinQuery* addJoinCond(JoinQuery* query, JoinColumn* column, int comp, char* value)
+{
+  if (query == NULL) {
+    query = new JoinQuery;
+    query->joined[0].attr = 0;
+    query->valid = true;
+  }
+  JoinCond c;
+  c.column = *column;
+  c.comp = static_cast<SelCond::Comparator>(comp);
+  c.value = value;
+  query->conds.push_back(c);
+  delete column;
+  return query;
+}
+
+static JoinQuery* addJoinColumns(JoinQuery* query, JoinColumn* left, JoinColumn* right)
+{
+  if (query == NULL) {
+    query = new JoinQuery;
+    query->joined[0].attr = 0;
+    query->valid = true;
+  }
+  if (query->joined[0].attr != 0) {
+    sqlerror("only one join condition between the tables is supported");
+    query->valid = false;
+  } else {
+    query->joined[0] = *left;
+    query->joined[1] = *right;
+  }
+  delete left;
+  delete right;
+  return query;
+}
+
+// free the condition values of a WHERE clause
+static void freeConds(Disjunction* conds)
+{
+  for (unsigned i = 0; i < conds->size(); i++) {
+    for (unsigned j = 0; j < (*conds)[i].size(); j++) {
+      free((*conds)[i][j].value);
+    }
+  }
+  delete conds;
 }
-/* Line 187 of yacc.c.  */
-#line 190 "SqlParser.tab.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
 
+// AND a list of alternative conditions (a single condition, or the
+// equalities of an IN list) to every conjunction of a WHERE clause.
+// every conjunction gets its own copy of the condition values.
+static Disjunction* andConds(Disjunction* conds, std::vector<SelCond>* alts)
+{
+  Disjunction* result = new Disjunction;
+  for (unsigned i = 0; i < conds->size(); i++) {
+    for (unsigned j = 0; j < alts->size(); j++) {
+      std::vector<SelCond> conj = (*conds)[i];
+      for (unsigned k = 0; k < conj.size(); k++) {
+        conj[k].value = strdup(conj[k].value);
+      }
+      conj.push_back((*alts)[j]);
+      conj.back().value = strdup(conj.back().value);
+      result->push_back(conj);
+    }
+  }
+  freeConds(conds);
+  for (unsigned j = 0; j < alts->size(); j++) {
+    free((*alts)[j].value);
+  }
+  delete alts;
+  return result;
+}
 
 
-/* Copy the second part of user declarations.  */
+#line 308 "SqlParser.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "SqlParser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SELECT = 3,                     /* SELECT  */
+  YYSYMBOL_FROM = 4,                       /* FROM  */
+  YYSYMBOL_WHERE = 5,                      /* WHERE  */
+  YYSYMBOL_LOAD = 6,                       /* LOAD  */
+  YYSYMBOL_WITH = 7,                       /* WITH  */
+  YYSYMBOL_INDEX = 8,                      /* INDEX  */
+  YYSYMBOL_QUIT = 9,                       /* QUIT  */
+  YYSYMBOL_COUNT = 10,                     /* COUNT  */
+  YYSYMBOL_AND = 11,                       /* AND  */
+  YYSYMBOL_OR = 12,                        /* OR  */
+  YYSYMBOL_EXPLAIN = 13,                   /* EXPLAIN  */
+  YYSYMBOL_ANALYZE = 14,                   /* ANALYZE  */
+  YYSYMBOL_ORDER = 15,                     /* ORDER  */
+  YYSYMBOL_GROUP = 16,                     /* GROUP  */
+  YYSYMBOL_BY = 17,                        /* BY  */
+  YYSYMBOL_ASC = 18,                       /* ASC  */
+  YYSYMBOL_DESC = 19,                      /* DESC  */
+  YYSYMBOL_LIMIT = 20,                     /* LIMIT  */
+  YYSYMBOL_SET = 21,                       /* SET  */
+  YYSYMBOL_COPY = 22,                      /* COPY  */
+  YYSYMBOL_TO = 23,                        /* TO  */
+  YYSYMBOL_AGGREGATE = 24,                 /* AGGREGATE  */
+  YYSYMBOL_IN = 25,                        /* IN  */
+  YYSYMBOL_LPAREN = 26,                    /* LPAREN  */
+  YYSYMBOL_RPAREN = 27,                    /* RPAREN  */
+  YYSYMBOL_COMMA = 28,                     /* COMMA  */
+  YYSYMBOL_DOT = 29,                       /* DOT  */
+  YYSYMBOL_STAR = 30,                      /* STAR  */
+  YYSYMBOL_LF = 31,                        /* LF  */
+  YYSYMBOL_INTEGER = 32,                   /* INTEGER  */
+  YYSYMBOL_STRING = 33,                    /* STRING  */
+  YYSYMBOL_ID = 34,                        /* ID  */
+  YYSYMBOL_EQUAL = 35,                     /* EQUAL  */
+  YYSYMBOL_NEQUAL = 36,                    /* NEQUAL  */
+  YYSYMBOL_LESS = 37,                      /* LESS  */
+  YYSYMBOL_LESSEQUAL = 38,                 /* LESSEQUAL  */
+  YYSYMBOL_GREATER = 39,                   /* GREATER  */
+  YYSYMBOL_GREATEREQUAL = 40,              /* GREATEREQUAL  */
+  YYSYMBOL_YYACCEPT = 41,                  /* $accept  */
+  YYSYMBOL_commands = 42,                  /* commands  */
+  YYSYMBOL_command = 43,                   /* command  */
+  YYSYMBOL_set_command = 44,               /* set_command  */
+  YYSYMBOL_quit_command = 45,              /* quit_command  */
+  YYSYMBOL_load_command = 46,              /* load_command  */
+  YYSYMBOL_copy_command = 47,              /* copy_command  */
+  YYSYMBOL_analyze_command = 48,           /* analyze_command  */
+  YYSYMBOL_select_command = 49,            /* select_command  */
+  YYSYMBOL_explain_command = 50,           /* explain_command  */
+  YYSYMBOL_join_clause = 51,               /* join_clause  */
+  YYSYMBOL_join_conditions = 52,           /* join_conditions  */
+  YYSYMBOL_columns = 53,                   /* columns  */
+  YYSYMBOL_column = 54,                    /* column  */
+  YYSYMBOL_conditions = 55,                /* conditions  */
+  YYSYMBOL_conjunction = 56,               /* conjunction  */
+  YYSYMBOL_condition = 57,                 /* condition  */
+  YYSYMBOL_values = 58,                    /* values  */
+  YYSYMBOL_group_clause = 59,              /* group_clause  */
+  YYSYMBOL_order_clause = 60,              /* order_clause  */
+  YYSYMBOL_limit_clause = 61,              /* limit_clause  */
+  YYSYMBOL_select_list = 62,               /* select_list  */
+  YYSYMBOL_attributes = 63,                /* attributes  */
+  YYSYMBOL_attribute = 64,                 /* attribute  */
+  YYSYMBOL_value = 65,                     /* value  */
+  YYSYMBOL_table = 66,                     /* table  */
+  YYSYMBOL_comparator = 67                 /* comparator  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
 
-/* Line 216 of yacc.c.  */
-#line 203 "SqlParser.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -237,55 +498,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
-# if YYENABLE_NLS
+# if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
 #endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -302,11 +614,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -314,8 +626,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -329,111 +641,117 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   33
+#define YYLAST   149
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  25
+#define YYNTOKENS  41
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  13
+#define YYNNTS  27
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  29
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  46
+#define YYNRULES  70
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  155
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   295
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   279
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -462,242 +780,253 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     6,     7,     9,    11,    13,    16,    18,
-      20,    26,    34,    40,    48,    50,    54,    58,    60,    62,
-      64,    66,    68,    70,    72,    74,    76,    78,    80,    82
+       0,   258,   258,   259,   263,   264,   265,   266,   267,   268,
+     269,   270,   271,   275,   284,   309,   322,   326,   331,   336,
+     345,   357,   365,   372,   377,   382,   386,   395,   400,   405,
+     409,   418,   428,   429,   430,   431,   435,   439,   447,   456,
+     457,   465,   473,   479,   486,   495,   501,   511,   512,   516,
+     517,   518,   519,   523,   524,   535,   536,   540,   541,   542,
+     543,   553,   561,   562,   566,   570,   571,   572,   573,   574,
+     575
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      26,     0,    -1,    26,    27,    -1,    -1,    29,    -1,    30,
-      -1,    28,    -1,     1,    15,    -1,    15,    -1,     9,    -1,
-       6,    36,     4,    17,    15,    -1,     6,    36,     4,    17,
-       7,     8,    15,    -1,     3,    33,     4,    36,    15,    -1,
-       3,    33,     4,    36,     5,    31,    15,    -1,    32,    -1,
-      31,    11,    32,    -1,    34,    37,    35,    -1,    34,    -1,
-      14,    -1,    10,    -1,    18,    -1,    16,    -1,    17,    -1,
-      18,    -1,    19,    -1,    20,    -1,    21,    -1,    23,    -1,
-      22,    -1,    24,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint8 yyrline[] =
-{
-       0,    51,    51,    52,    56,    57,    58,    59,    60,    64,
-      68,    73,    81,    86,    97,   103,   111,   121,   122,   123,
-     127,   135,   136,   140,   144,   145,   146,   147,   148,   149
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SELECT", "FROM", "WHERE", "LOAD",
-  "WITH", "INDEX", "QUIT", "COUNT", "AND", "OR", "COMMA", "STAR", "LF",
-  "INTEGER", "STRING", "ID", "EQUAL", "NEQUAL", "LESS", "LESSEQUAL",
-  "GREATER", "GREATEREQUAL", "$accept", "commands", "command",
-  "quit_command", "load_command", "select_command", "conditions",
-  "condition", "attributes", "attribute", "value", "table", "comparator", 0
+  "\"end of file\"", "error", "\"invalid token\"", "SELECT", "FROM",
+  "WHERE", "LOAD", "WITH", "INDEX", "QUIT", "COUNT", "AND", "OR",
+  "EXPLAIN", "ANALYZE", "ORDER", "GROUP", "BY", "ASC", "DESC", "LIMIT",
+  "SET", "COPY", "TO", "AGGREGATE", "IN", "LPAREN", "RPAREN", "COMMA",
+  "DOT", "STAR", "LF", "INTEGER", "STRING", "ID", "EQUAL", "NEQUAL",
+  "LESS", "LESSEQUAL", "GREATER", "GREATEREQUAL", "$accept", "commands",
+  "command", "set_command", "quit_command", "load_command", "copy_command",
+  "analyze_command", "select_command", "explain_command", "join_clause",
+  "join_conditions", "columns", "column", "conditions", "conjunction",
+  "condition", "values", "group_clause", "order_clause", "limit_clause",
+  "select_list", "attributes", "attribute", "value", "table", "comparator", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-120)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-65)
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
 {
-       0,    25,    26,    26,    27,    27,    27,    27,    27,    28,
-      29,    29,    30,    30,    31,    31,    32,    33,    33,    33,
-      34,    35,    35,    36,    37,    37,    37,    37,    37,    37
+    -120,    46,  -120,    -4,    -8,     5,  -120,    29,     5,    -1,
+       5,  -120,  -120,  -120,  -120,  -120,  -120,  -120,  -120,  -120,
+    -120,  -120,    25,  -120,    32,     8,  -120,    62,  -120,    41,
+      49,  -120,    76,    -8,    50,    45,   -15,    64,    55,     5,
+       5,    59,     5,    60,    40,    55,   -10,     8,    91,  -120,
+      85,    86,    87,    88,  -120,    92,    94,  -120,  -120,    57,
+    -120,  -120,  -120,  -120,    13,    14,    89,     5,    93,  -120,
+    -120,  -120,    95,  -120,     5,    55,   106,   110,   119,  -120,
+     120,  -120,  -120,    66,  -120,  -120,   124,     2,   121,  -120,
+      61,    55,   113,   111,   102,   103,    55,   110,     5,    55,
+     110,    55,   109,  -120,  -120,  -120,  -120,  -120,  -120,    21,
+    -120,    55,   104,   107,  -120,  -120,     2,   111,   126,    67,
+     121,   111,  -120,    21,  -120,  -120,  -120,    38,  -120,  -120,
+     110,   108,     5,     5,    21,   112,    48,  -120,  -120,  -120,
+     111,  -120,    75,  -120,  -120,  -120,  -120,    21,   114,     5,
+      21,  -120,  -120,  -120,  -120
 };
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
 {
-       0,     2,     2,     0,     1,     1,     1,     2,     1,     1,
-       5,     7,     5,     7,     1,     3,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1
+       3,     0,     1,     0,     0,     0,    16,     0,     0,     0,
+       0,    12,     2,     8,    10,     4,     9,     7,     5,     6,
+      11,    59,     0,    58,    61,     0,    36,     0,    55,    57,
+       0,    64,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    22,
+       0,     0,     0,     0,    61,     0,     0,    37,    26,    47,
+      25,    56,    57,    38,     0,     0,     0,     0,     0,    15,
+      13,    14,     0,    60,     0,     0,     0,    49,     0,    17,
+       0,    19,    30,    47,    29,    21,     0,    47,    39,    41,
+       0,     0,     0,    53,     0,     0,     0,    49,     0,     0,
+      49,     0,     0,    65,    66,    67,    69,    68,    70,     0,
+      48,     0,     0,     0,    18,    20,    47,    53,    31,     0,
+      40,    53,    42,     0,    62,    63,    43,    50,    54,    23,
+      49,     0,     0,    65,     0,     0,     0,    45,    51,    52,
+      53,    27,     0,    33,    32,    24,    44,     0,     0,    65,
+       0,    46,    28,    35,    34
 };
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
 {
-       3,     0,     1,     0,     0,     0,     9,     8,     2,     6,
-       4,     5,     7,    19,    18,    20,     0,    17,    23,     0,
-       0,     0,     0,     0,     0,    12,     0,    10,     0,    14,
-       0,     0,     0,    13,    24,    25,    26,    28,    27,    29,
-       0,    11,    15,    21,    22,    16
+    -120,  -120,  -120,  -120,  -120,  -120,  -120,  -120,  -120,  -120,
+      36,  -120,   115,   -40,    44,    42,    43,  -120,   -78,   -87,
+     -92,   116,    98,    -3,  -119,    -2,  -108
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
+static const yytype_uint8 yydefgoto[] =
 {
-      -1,     1,     8,     9,    10,    11,    28,    29,    16,    30,
-      45,    19,    40
+       0,     1,    12,    13,    14,    15,    16,    17,    18,    19,
+      41,   118,    25,    26,    87,    88,    89,   136,    77,    93,
+     113,    27,    28,    90,   126,    30,   109
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -14
-static const yytype_int8 yypact[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-     -14,     0,   -14,    -5,     3,     2,   -14,   -14,   -14,   -14,
-     -14,   -14,   -14,   -14,   -14,   -14,    10,   -14,   -14,    14,
-       2,     5,    -3,     1,    11,   -14,    22,   -14,    -4,   -14,
-       4,    16,    11,   -14,   -14,   -14,   -14,   -14,   -14,   -14,
-     -12,   -14,   -14,   -14,   -14,   -14
+      57,    29,    21,    32,   137,    97,    34,    35,    37,   100,
+     117,   134,    39,   121,    99,   144,    22,    51,    76,    52,
+      78,    80,    23,    64,    65,   131,    24,    20,   151,   135,
+      29,   154,    33,    36,   150,    55,    40,    56,   130,    31,
+      59,    62,    63,   140,    79,    81,     2,     3,   148,     4,
+      21,    38,     5,   124,   125,     6,   138,   139,   119,     7,
+       8,   -64,    75,    43,    22,    83,    42,     9,    10,    44,
+      23,    96,    86,    76,    54,   146,   147,    11,    45,    50,
+      46,    49,    76,    66,    68,    74,   102,    53,   110,    54,
+      58,    60,   142,   143,    74,    67,   103,   104,   105,   106,
+     107,   108,   133,   104,   105,   106,   107,   108,   127,   153,
+     149,   104,   105,   106,   107,   108,    69,    70,    71,    73,
+      82,    72,    74,    91,    84,    92,    85,    94,    95,    98,
+     111,   112,   101,   114,   115,   123,   128,   132,   129,   141,
+     116,   120,    61,   145,   122,   152,     0,     0,    47,    48
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int8 yypgoto[] =
+static const yytype_int16 yycheck[] =
 {
-     -14,   -14,   -14,   -14,   -14,   -14,   -14,   -13,   -14,    28,
-     -14,    13,   -14
+      40,     4,    10,     5,   123,    83,     8,     8,    10,    87,
+      97,   119,     4,   100,    12,   134,    24,    32,    16,    34,
+       7,     7,    30,    33,    34,   117,    34,    31,   147,   121,
+      33,   150,     3,    34,   142,    38,    28,    39,   116,    34,
+      42,    44,    45,   130,    31,    31,     0,     1,   140,     3,
+      10,    26,     6,    32,    33,     9,    18,    19,    98,    13,
+      14,    29,     5,    27,    24,    67,     4,    21,    22,    28,
+      30,     5,    74,    16,    34,    27,    28,    31,    29,    34,
+       4,    31,    16,    47,    48,    28,    25,    23,    91,    34,
+      31,    31,   132,   133,    28,     4,    35,    36,    37,    38,
+      39,    40,    35,    36,    37,    38,    39,    40,   111,   149,
+      35,    36,    37,    38,    39,    40,    31,    31,    31,    27,
+      31,    33,    28,    17,    31,    15,    31,     8,     8,     5,
+      17,    20,    11,    31,    31,    26,    32,    11,    31,    31,
+      96,    99,    44,    31,   101,    31,    -1,    -1,    33,    33
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
-static const yytype_uint8 yytable[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
-       2,     3,    24,     4,    43,    44,     5,    32,    26,     6,
-      12,    33,    25,    13,    20,     7,    27,    14,    21,    42,
-      18,    15,    23,    34,    35,    36,    37,    38,    39,    15,
-      31,    41,    17,    22
+       0,    42,     0,     1,     3,     6,     9,    13,    14,    21,
+      22,    31,    43,    44,    45,    46,    47,    48,    49,    50,
+      31,    10,    24,    30,    34,    53,    54,    62,    63,    64,
+      66,    34,    66,     3,    66,     8,    34,    66,    26,     4,
+      28,    51,     4,    51,    28,    29,     4,    53,    62,    31,
+      34,    32,    34,    23,    34,    64,    66,    54,    31,    66,
+      31,    63,    64,    64,    33,    34,    51,     4,    51,    31,
+      31,    31,    33,    27,    28,     5,    16,    59,     7,    31,
+       7,    31,    31,    66,    31,    31,    66,    55,    56,    57,
+      64,    17,    15,    60,     8,     8,     5,    59,     5,    12,
+      59,    11,    25,    35,    36,    37,    38,    39,    40,    67,
+      64,    17,    20,    61,    31,    31,    55,    60,    52,    54,
+      56,    60,    57,    26,    32,    33,    65,    64,    32,    31,
+      59,    61,    11,    35,    67,    61,    58,    65,    18,    19,
+      60,    31,    54,    54,    65,    31,    27,    28,    61,    35,
+      67,    65,    31,    54,    65
 };
 
-static const yytype_uint8 yycheck[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
 {
-       0,     1,     5,     3,    16,    17,     6,    11,     7,     9,
-      15,    15,    15,    10,     4,    15,    15,    14,     4,    32,
-      18,    18,    17,    19,    20,    21,    22,    23,    24,    18,
-       8,    15,     4,    20
+       0,    41,    42,    42,    43,    43,    43,    43,    43,    43,
+      43,    43,    43,    44,    44,    44,    45,    46,    46,    46,
+      46,    47,    48,    49,    49,    49,    49,    50,    50,    50,
+      50,    51,    52,    52,    52,    52,    53,    53,    54,    55,
+      55,    56,    56,    57,    57,    58,    58,    59,    59,    60,
+      60,    60,    60,    61,    61,    62,    62,    63,    63,    63,
+      63,    64,    65,    65,    66,    67,    67,    67,    67,    67,
+      67
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
-       0,    26,     0,     1,     3,     6,     9,    15,    27,    28,
-      29,    30,    15,    10,    14,    18,    33,    34,    18,    36,
-       4,     4,    36,    17,     5,    15,     7,    15,    31,    32,
-      34,     8,    11,    15,    19,    20,    21,    22,    23,    24,
-      37,    15,    32,    16,    17,    35
+       0,     2,     2,     0,     1,     1,     1,     1,     1,     1,
+       1,     2,     1,     4,     4,     4,     1,     5,     7,     5,
+       7,     5,     3,     8,    10,     4,     4,     9,    11,     5,
+       5,     6,     3,     3,     5,     5,     1,     3,     3,     1,
+       3,     1,     3,     3,     5,     1,     3,     0,     3,     0,
+       3,     4,     4,     0,     2,     1,     3,     1,     1,     1,
+       4,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
 
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#define YYFAIL		goto yyerrlab
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
-
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
-
-#ifndef YY_LOCATION_PRINT
-# if YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -707,80 +1036,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -788,80 +1095,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -876,478 +1171,219 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
-
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
-
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
 
 
-/* The look-ahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
+/* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
 
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
-
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
-
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
-
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
-
-  YYSIZE_T yystacksize = YYINITDEPTH;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1362,30 +1398,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1400,14 +1432,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1420,266 +1452,648 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 4:
-#line 56 "SqlParser.y"
-    { fprintf(stdout, "Bruinbase> "); ;}
+  case 4: /* command: load_command  */
+#line 263 "SqlParser.y"
+                     { fprintf(stdout, "Bruinbase> "); }
+#line 1459 "SqlParser.tab.c"
     break;
 
-  case 5:
-#line 57 "SqlParser.y"
-    { fprintf(stdout, "Bruinbase> "); ;}
+  case 5: /* command: select_command  */
+#line 264 "SqlParser.y"
+                         { fprintf(stdout, "Bruinbase> "); }
+#line 1465 "SqlParser.tab.c"
     break;
 
-  case 7:
-#line 59 "SqlParser.y"
-    { fprintf(stdout, "Bruinbase> "); ;}
+  case 6: /* command: explain_command  */
+#line 265 "SqlParser.y"
+                          { fprintf(stdout, "Bruinbase> "); }
+#line 1471 "SqlParser.tab.c"
     break;
 
-  case 8:
-#line 60 "SqlParser.y"
-    { fprintf(stdout, "Bruinbase> "); ;}
+  case 7: /* command: analyze_command  */
+#line 266 "SqlParser.y"
+                          { fprintf(stdout, "Bruinbase> "); }
+#line 1477 "SqlParser.tab.c"
     break;
 
-  case 9:
-#line 64 "SqlParser.y"
-    { return 0; ;}
+  case 8: /* command: set_command  */
+#line 267 "SqlParser.y"
+                      { fprintf(stdout, "Bruinbase> "); }
+#line 1483 "SqlParser.tab.c"
     break;
 
-  case 10:
-#line 68 "SqlParser.y"
-    { 
-	  SqlEngine::load(std::string((yyvsp[(2) - (5)].string)), std::string((yyvsp[(4) - (5)].string)), false); 
-	  free((yyvsp[(2) - (5)].string));
-	  free((yyvsp[(4) - (5)].string));
-	;}
+  case 9: /* command: copy_command  */
+#line 268 "SqlParser.y"
+                       { fprintf(stdout, "Bruinbase> "); }
+#line 1489 "SqlParser.tab.c"
     break;
 
-  case 11:
-#line 73 "SqlParser.y"
-    { 
-	  SqlEngine::load(std::string((yyvsp[(2) - (7)].string)), std::string((yyvsp[(4) - (7)].string)), true); 
-	  free((yyvsp[(2) - (7)].string));
-	  free((yyvsp[(4) - (7)].string));
-	;}
+  case 11: /* command: error LF  */
+#line 270 "SqlParser.y"
+                   { fprintf(stdout, "Bruinbase> "); }
+#line 1495 "SqlParser.tab.c"
     break;
 
-  case 12:
-#line 81 "SqlParser.y"
-    {
-   	        std::vector<SelCond> conds;
-		runSelect((yyvsp[(2) - (5)].integer), (yyvsp[(4) - (5)].string), conds);
-		free((yyvsp[(4) - (5)].string));
-	;}
+  case 12: /* command: LF  */
+#line 271 "SqlParser.y"
+             { fprintf(stdout, "Bruinbase> "); }
+#line 1501 "SqlParser.tab.c"
     break;
 
-  case 13:
-#line 86 "SqlParser.y"
-    {
-	        runSelect((yyvsp[(2) - (7)].integer), (yyvsp[(4) - (7)].string), *(yyvsp[(6) - (7)].conds));
-	  	free((yyvsp[(4) - (7)].string));
-	  	for (unsigned i = 0; i < (yyvsp[(6) - (7)].conds)->size(); i++) {
-		    free((*(yyvsp[(6) - (7)].conds))[i].value);
+  case 13: /* set_command: SET ID INTEGER LF  */
+#line 275 "SqlParser.y"
+                          {
+	  if (strcmp((yyvsp[-2].string), "threads") == 0) {
+	    SqlEngine::setThreads(atoi((yyvsp[-1].string)));
+	  } else {
+	    sqlerror("unknown setting. try SET THREADS n");
+	  }
+	  free((yyvsp[-2].string));
+	  free((yyvsp[-1].string));
+	}
+#line 1515 "SqlParser.tab.c"
+    break;
+
+  case 14: /* set_command: SET ID ID LF  */
+#line 284 "SqlParser.y"
+                       {
+	  if (strcmp((yyvsp[-2].string), "storage") == 0) {
+	    if (strcmp((yyvsp[-1].string), "compressed") == 0) {
+	      SqlEngine::setTableStorage(RecordFile::COMPRESSED);
+	    } else if (strcmp((yyvsp[-1].string), "columnar") == 0) {
+	      SqlEngine::setTableStorage(RecordFile::COLUMNAR);
+	    } else if (strcmp((yyvsp[-1].string), "plain") == 0) {
+	      SqlEngine::setTableStorage(RecordFile::PLAIN);
+	    } else {
+	      sqlerror("unknown storage. try SET STORAGE compressed|columnar|plain");
+	    }
+	  } else if (strcmp((yyvsp[-2].string), "output") != 0) {
+	    sqlerror("unknown setting. try SET OUTPUT text|tsv|binary");
+	  } else if (strcmp((yyvsp[-1].string), "text") == 0) {
+	    SqlEngine::setOutputFormat(ResultSink::TEXT);
+	  } else if (strcmp((yyvsp[-1].string), "tsv") == 0) {
+	    SqlEngine::setOutputFormat(ResultSink::TSV);
+	  } else if (strcmp((yyvsp[-1].string), "binary") == 0) {
+	    SqlEngine::setOutputFormat(ResultSink::BINARY);
+	  } else {
+	    sqlerror("unknown output format. try text, tsv or binary");
+	  }
+	  free((yyvsp[-2].string));
+	  free((yyvsp[-1].string));
+	}
+#line 1545 "SqlParser.tab.c"
+    break;
+
+  case 15: /* set_command: SET INDEX ID LF  */
+#line 309 "SqlParser.y"
+                          {
+	  if (strcmp((yyvsp[-1].string), "compressed") == 0) {
+	    SqlEngine::setIndexCompression(true);
+	  } else if (strcmp((yyvsp[-1].string), "plain") == 0) {
+	    SqlEngine::setIndexCompression(false);
+	  } else {
+	    sqlerror("unknown index format. try SET INDEX compressed|plain");
+	  }
+	  free((yyvsp[-1].string));
+	}
+#line 1560 "SqlParser.tab.c"
+    break;
+
+  case 16: /* quit_command: QUIT  */
+#line 322 "SqlParser.y"
+             { return 0; }
+#line 1566 "SqlParser.tab.c"
+    break;
+
+  case 17: /* load_command: LOAD table FROM STRING LF  */
+#line 326 "SqlParser.y"
+                                  { 
+	  SqlEngine::load(std::string((yyvsp[-3].string)), std::string((yyvsp[-1].string)), false); 
+	  free((yyvsp[-3].string));
+	  free((yyvsp[-1].string));
+	}
+#line 1576 "SqlParser.tab.c"
+    break;
+
+  case 18: /* load_command: LOAD table FROM STRING WITH INDEX LF  */
+#line 331 "SqlParser.y"
+                                               { 
+	  SqlEngine::load(std::string((yyvsp[-5].string)), std::string((yyvsp[-3].string)), true); 
+	  free((yyvsp[-5].string));
+	  free((yyvsp[-3].string));
+	}
+#line 1586 "SqlParser.tab.c"
+    break;
+
+  case 19: /* load_command: LOAD table FROM ID LF  */
+#line 336 "SqlParser.y"
+                                {
+	  if (strcmp((yyvsp[-1].string), "stdin") == 0) {
+	    SqlEngine::load(std::string((yyvsp[-3].string)), sqlin, false);
+	  } else {
+	    sqlerror("unknown load source. try LOAD table FROM 'file' or FROM STDIN");
+	  }
+	  free((yyvsp[-3].string));
+	  free((yyvsp[-1].string));
+	}
+#line 1600 "SqlParser.tab.c"
+    break;
+
+  case 20: /* load_command: LOAD table FROM ID WITH INDEX LF  */
+#line 345 "SqlParser.y"
+                                           {
+	  if (strcmp((yyvsp[-3].string), "stdin") == 0) {
+	    SqlEngine::load(std::string((yyvsp[-5].string)), sqlin, true);
+	  } else {
+	    sqlerror("unknown load source. try LOAD table FROM 'file' or FROM STDIN");
+	  }
+	  free((yyvsp[-5].string));
+	  free((yyvsp[-3].string));
+	}
+#line 1614 "SqlParser.tab.c"
+    break;
+
+  case 21: /* copy_command: COPY table TO STRING LF  */
+#line 357 "SqlParser.y"
+                                {
+	  SqlEngine::copy(std::string((yyvsp[-3].string)), std::string((yyvsp[-1].string)));
+	  free((yyvsp[-3].string));
+	  free((yyvsp[-1].string));
+	}
+#line 1624 "SqlParser.tab.c"
+    break;
+
+  case 22: /* analyze_command: ANALYZE table LF  */
+#line 365 "SqlParser.y"
+                         {
+	  SqlEngine::analyze(std::string((yyvsp[-1].string)));
+	  free((yyvsp[-1].string));
+	}
+#line 1633 "SqlParser.tab.c"
+    break;
+
+  case 23: /* select_command: SELECT select_list FROM table group_clause order_clause limit_clause LF  */
+#line 372 "SqlParser.y"
+                                                                                {
+   	        Disjunction conds(1);
+		runSelect((yyvsp[-6].integer), (yyvsp[-4].string), conds, (yyvsp[-3].integer), (yyvsp[-2].integer), (yyvsp[-1].integer));
+		free((yyvsp[-4].string));
+	}
+#line 1643 "SqlParser.tab.c"
+    break;
+
+  case 24: /* select_command: SELECT select_list FROM table WHERE conditions group_clause order_clause limit_clause LF  */
+#line 377 "SqlParser.y"
+                                                                                                   {
+	        runSelect((yyvsp[-8].integer), (yyvsp[-6].string), *(yyvsp[-4].disjunction), (yyvsp[-3].integer), (yyvsp[-2].integer), (yyvsp[-1].integer));
+	  	free((yyvsp[-6].string));
+	  	freeConds((yyvsp[-4].disjunction));
+	}
+#line 1653 "SqlParser.tab.c"
+    break;
+
+  case 25: /* select_command: SELECT select_list join_clause LF  */
+#line 382 "SqlParser.y"
+                                            {
+		if (setJoinColumns((yyvsp[-1].join), (yyvsp[-2].integer))) runJoin(*(yyvsp[-1].join));
+		freeJoin((yyvsp[-1].join));
+	}
+#line 1662 "SqlParser.tab.c"
+    break;
+
+  case 26: /* select_command: SELECT columns join_clause LF  */
+#line 386 "SqlParser.y"
+                                        {
+		(yyvsp[-1].join)->columns = *(yyvsp[-2].columns);
+		runJoin(*(yyvsp[-1].join));
+		delete (yyvsp[-2].columns);
+		freeJoin((yyvsp[-1].join));
+	}
+#line 1673 "SqlParser.tab.c"
+    break;
+
+  case 27: /* explain_command: EXPLAIN SELECT select_list FROM table group_clause order_clause limit_clause LF  */
+#line 395 "SqlParser.y"
+                                                                                        {
+   	        Disjunction conds(1);
+		runExplain((yyvsp[-6].integer), (yyvsp[-4].string), conds, (yyvsp[-3].integer), (yyvsp[-2].integer), (yyvsp[-1].integer));
+		free((yyvsp[-4].string));
+	}
+#line 1683 "SqlParser.tab.c"
+    break;
+
+  case 28: /* explain_command: EXPLAIN SELECT select_list FROM table WHERE conditions group_clause order_clause limit_clause LF  */
+#line 400 "SqlParser.y"
+                                                                                                           {
+	        runExplain((yyvsp[-8].integer), (yyvsp[-6].string), *(yyvsp[-4].disjunction), (yyvsp[-3].integer), (yyvsp[-2].integer), (yyvsp[-1].integer));
+	  	free((yyvsp[-6].string));
+	  	freeConds((yyvsp[-4].disjunction));
+	}
+#line 1693 "SqlParser.tab.c"
+    break;
+
+  case 29: /* explain_command: EXPLAIN SELECT select_list join_clause LF  */
+#line 405 "SqlParser.y"
+                                                    {
+		if (setJoinColumns((yyvsp[-1].join), (yyvsp[-2].integer))) runExplainJoin(*(yyvsp[-1].join));
+		freeJoin((yyvsp[-1].join));
+	}
+#line 1702 "SqlParser.tab.c"
+    break;
+
+  case 30: /* explain_command: EXPLAIN SELECT columns join_clause LF  */
+#line 409 "SqlParser.y"
+                                                {
+		(yyvsp[-1].join)->columns = *(yyvsp[-2].columns);
+		runExplainJoin(*(yyvsp[-1].join));
+		delete (yyvsp[-2].columns);
+		freeJoin((yyvsp[-1].join));
+	}
+#line 1713 "SqlParser.tab.c"
+    break;
+
+  case 31: /* join_clause: FROM table COMMA table WHERE join_conditions  */
+#line 418 "SqlParser.y"
+                                                     {
+	  (yyvsp[0].join)->table[0] = (yyvsp[-4].string);
+	  (yyvsp[0].join)->table[1] = (yyvsp[-2].string);
+	  free((yyvsp[-4].string));
+	  free((yyvsp[-2].string));
+	  (yyval.join) = (yyvsp[0].join);
+	}
+#line 1725 "SqlParser.tab.c"
+    break;
+
+  case 32: /* join_conditions: column comparator value  */
+#line 428 "SqlParser.y"
+                                { (yyval.join) = addJoinCond(NULL, (yyvsp[-2].column), (yyvsp[-1].integer), (yyvsp[0].string)); }
+#line 1731 "SqlParser.tab.c"
+    break;
+
+  case 33: /* join_conditions: column EQUAL column  */
+#line 429 "SqlParser.y"
+                              { (yyval.join) = addJoinColumns(NULL, (yyvsp[-2].column), (yyvsp[0].column)); }
+#line 1737 "SqlParser.tab.c"
+    break;
+
+  case 34: /* join_conditions: join_conditions AND column comparator value  */
+#line 430 "SqlParser.y"
+                                                      { (yyval.join) = addJoinCond((yyvsp[-4].join), (yyvsp[-2].column), (yyvsp[-1].integer), (yyvsp[0].string)); }
+#line 1743 "SqlParser.tab.c"
+    break;
+
+  case 35: /* join_conditions: join_conditions AND column EQUAL column  */
+#line 431 "SqlParser.y"
+                                                  { (yyval.join) = addJoinColumns((yyvsp[-4].join), (yyvsp[-2].column), (yyvsp[0].column)); }
+#line 1749 "SqlParser.tab.c"
+    break;
+
+  case 36: /* columns: column  */
+#line 435 "SqlParser.y"
+               {
+	  (yyval.columns) = new std::vector<JoinColumn>(1, *(yyvsp[0].column));
+	  delete (yyvsp[0].column);
+	}
+#line 1758 "SqlParser.tab.c"
+    break;
+
+  case 37: /* columns: columns COMMA column  */
+#line 439 "SqlParser.y"
+                               {
+	  (yyvsp[-2].columns)->push_back(*(yyvsp[0].column));
+	  (yyval.columns) = (yyvsp[-2].columns);
+	  delete (yyvsp[0].column);
+	}
+#line 1768 "SqlParser.tab.c"
+    break;
+
+  case 38: /* column: table DOT attribute  */
+#line 447 "SqlParser.y"
+                            {
+	  (yyval.column) = new JoinColumn;
+	  (yyval.column)->table = (yyvsp[-2].string);
+	  (yyval.column)->attr = (yyvsp[0].integer);
+	  free((yyvsp[-2].string));
+	}
+#line 1779 "SqlParser.tab.c"
+    break;
+
+  case 39: /* conditions: conjunction  */
+#line 456 "SqlParser.y"
+                    { (yyval.disjunction) = (yyvsp[0].disjunction); }
+#line 1785 "SqlParser.tab.c"
+    break;
+
+  case 40: /* conditions: conditions OR conjunction  */
+#line 457 "SqlParser.y"
+                                    {
+	  (yyvsp[-2].disjunction)->insert((yyvsp[-2].disjunction)->end(), (yyvsp[0].disjunction)->begin(), (yyvsp[0].disjunction)->end());
+	  (yyval.disjunction) = (yyvsp[-2].disjunction);
+	  delete (yyvsp[0].disjunction);
+	}
+#line 1795 "SqlParser.tab.c"
+    break;
+
+  case 41: /* conjunction: condition  */
+#line 465 "SqlParser.y"
+                  {
+	  Disjunction* d = new Disjunction;
+	  for (unsigned i = 0; i < (yyvsp[0].conds)->size(); i++) {
+	    d->push_back(std::vector<SelCond>(1, (*(yyvsp[0].conds))[i]));
+	  }
+	  (yyval.disjunction) = d;
+	  delete (yyvsp[0].conds);
+	}
+#line 1808 "SqlParser.tab.c"
+    break;
+
+  case 42: /* conjunction: conjunction AND condition  */
+#line 473 "SqlParser.y"
+                                    {
+	  (yyval.disjunction) = andConds((yyvsp[-2].disjunction), (yyvsp[0].conds));
+	}
+#line 1816 "SqlParser.tab.c"
+    break;
+
+  case 43: /* condition: attribute comparator value  */
+#line 479 "SqlParser.y"
+                                   { 
+	  SelCond c;
+	  c.attr = (yyvsp[-2].integer);
+	  c.comp = static_cast<SelCond::Comparator>((yyvsp[-1].integer));
+	  c.value = (yyvsp[0].string);
+	  (yyval.conds) = new std::vector<SelCond>(1, c);
+        }
+#line 1828 "SqlParser.tab.c"
+    break;
+
+  case 44: /* condition: attribute IN LPAREN values RPAREN  */
+#line 486 "SqlParser.y"
+                                            {
+	  for (unsigned i = 0; i < (yyvsp[-1].conds)->size(); i++) {
+	    (*(yyvsp[-1].conds))[i].attr = (yyvsp[-4].integer);
+	  }
+	  (yyval.conds) = (yyvsp[-1].conds);
+	}
+#line 1839 "SqlParser.tab.c"
+    break;
+
+  case 45: /* values: value  */
+#line 495 "SqlParser.y"
+              {
+	  SelCond c;
+	  c.comp = SelCond::EQ;
+	  c.value = (yyvsp[0].string);
+	  (yyval.conds) = new std::vector<SelCond>(1, c);
+	}
+#line 1850 "SqlParser.tab.c"
+    break;
+
+  case 46: /* values: values COMMA value  */
+#line 501 "SqlParser.y"
+                             {
+	  SelCond c;
+	  c.comp = SelCond::EQ;
+	  c.value = (yyvsp[0].string);
+	  (yyvsp[-2].conds)->push_back(c);
+	  (yyval.conds) = (yyvsp[-2].conds);
+	}
+#line 1862 "SqlParser.tab.c"
+    break;
+
+  case 47: /* group_clause: %empty  */
+#line 511 "SqlParser.y"
+                    { (yyval.integer) = 0; }
+#line 1868 "SqlParser.tab.c"
+    break;
+
+  case 48: /* group_clause: GROUP BY attribute  */
+#line 512 "SqlParser.y"
+                             { (yyval.integer) = (yyvsp[0].integer); }
+#line 1874 "SqlParser.tab.c"
+    break;
+
+  case 49: /* order_clause: %empty  */
+#line 516 "SqlParser.y"
+                    { (yyval.integer) = 0; }
+#line 1880 "SqlParser.tab.c"
+    break;
+
+  case 50: /* order_clause: ORDER BY attribute  */
+#line 517 "SqlParser.y"
+                             { (yyval.integer) = (yyvsp[0].integer); }
+#line 1886 "SqlParser.tab.c"
+    break;
+
+  case 51: /* order_clause: ORDER BY attribute ASC  */
+#line 518 "SqlParser.y"
+                                 { (yyval.integer) = (yyvsp[-1].integer); }
+#line 1892 "SqlParser.tab.c"
+    break;
+
+  case 52: /* order_clause: ORDER BY attribute DESC  */
+#line 519 "SqlParser.y"
+                                  { (yyval.integer) = -(yyvsp[-1].integer); }
+#line 1898 "SqlParser.tab.c"
+    break;
+
+  case 53: /* limit_clause: %empty  */
+#line 523 "SqlParser.y"
+                    { (yyval.integer) = -1; }
+#line 1904 "SqlParser.tab.c"
+    break;
+
+  case 54: /* limit_clause: LIMIT INTEGER  */
+#line 524 "SqlParser.y"
+                        {
+		(yyval.integer) = atoi((yyvsp[0].string));
+		if ((yyval.integer) < 0) {
+			sqlerror("LIMIT must not be negative");
+			(yyval.integer) = 0;
 		}
-	  	delete (yyvsp[(6) - (7)].conds);
-	;}
+		free((yyvsp[0].string));
+	}
+#line 1917 "SqlParser.tab.c"
     break;
 
-  case 14:
-#line 97 "SqlParser.y"
-    {
-	  std::vector<SelCond>* v = new std::vector<SelCond>;
-	  v->push_back(*(yyvsp[(1) - (1)].cond));
-	  (yyval.conds) = v;
-          delete (yyvsp[(1) - (1)].cond);
-	;}
+  case 55: /* select_list: attributes  */
+#line 535 "SqlParser.y"
+                   { (yyval.integer) = (yyvsp[0].integer); }
+#line 1923 "SqlParser.tab.c"
     break;
 
-  case 15:
-#line 103 "SqlParser.y"
-    {
-	  (yyvsp[(1) - (3)].conds)->push_back(*(yyvsp[(3) - (3)].cond));
-	  (yyval.conds) = (yyvsp[(1) - (3)].conds);
-          delete (yyvsp[(3) - (3)].cond);
-	;}
+  case 56: /* select_list: attribute COMMA attributes  */
+#line 536 "SqlParser.y"
+                                     { (yyval.integer) = ((yyvsp[-2].integer) << 8) | (yyvsp[0].integer); }
+#line 1929 "SqlParser.tab.c"
     break;
 
-  case 16:
-#line 111 "SqlParser.y"
-    { 
-	  SelCond* c = new SelCond;
-	  c->attr = (yyvsp[(1) - (3)].integer);
-	  c->comp = static_cast<SelCond::Comparator>((yyvsp[(2) - (3)].integer));
-	  c->value = (yyvsp[(3) - (3)].string);
-	  (yyval.cond) = c;
-        ;}
+  case 57: /* attributes: attribute  */
+#line 540 "SqlParser.y"
+                  { (yyval.integer) = (yyvsp[0].integer); }
+#line 1935 "SqlParser.tab.c"
     break;
 
-  case 17:
-#line 121 "SqlParser.y"
-    { (yyval.integer) = (yyvsp[(1) - (1)].integer); ;}
+  case 58: /* attributes: STAR  */
+#line 541 "SqlParser.y"
+                { (yyval.integer) = 3; }
+#line 1941 "SqlParser.tab.c"
     break;
 
-  case 18:
-#line 122 "SqlParser.y"
-    { (yyval.integer) = 3; ;}
+  case 59: /* attributes: COUNT  */
+#line 542 "SqlParser.y"
+                { (yyval.integer) = 4; }
+#line 1947 "SqlParser.tab.c"
     break;
 
-  case 19:
-#line 123 "SqlParser.y"
-    { (yyval.integer) = 4; ;}
+  case 60: /* attributes: AGGREGATE LPAREN attribute RPAREN  */
+#line 543 "SqlParser.y"
+                                            {
+		if ((yyvsp[-3].integer) >= SelectOptions::SUM && (yyvsp[-1].integer) != 1) {
+			sqlerror("SUM and AVG apply to the key column only");
+			YYERROR;
+		}
+		(yyval.integer) = ((yyvsp[-3].integer) << 4) | (yyvsp[-1].integer);
+	}
+#line 1959 "SqlParser.tab.c"
     break;
 
-  case 20:
-#line 127 "SqlParser.y"
-    { 
-		if (strcasecmp((yyvsp[(1) - (1)].string), "key") == 0) (yyval.integer)=1;
-		else if (strcasecmp((yyvsp[(1) - (1)].string), "value") == 0) (yyval.integer)=2;
+  case 61: /* attribute: ID  */
+#line 553 "SqlParser.y"
+           { 
+		if (strcasecmp((yyvsp[0].string), "key") == 0) (yyval.integer)=1;
+		else if (strcasecmp((yyvsp[0].string), "value") == 0) (yyval.integer)=2;
 		else sqlerror("wrong attribute name. neither key or value");
-		free((yyvsp[(1) - (1)].string));
-	;}
+		free((yyvsp[0].string));
+	}
+#line 1970 "SqlParser.tab.c"
     break;
 
-  case 21:
-#line 135 "SqlParser.y"
-    { (yyval.string) = (yyvsp[(1) - (1)].string); ;}
+  case 62: /* value: INTEGER  */
+#line 561 "SqlParser.y"
+                 { (yyval.string) = (yyvsp[0].string); }
+#line 1976 "SqlParser.tab.c"
     break;
 
-  case 22:
-#line 136 "SqlParser.y"
-    { (yyval.string) = (yyvsp[(1) - (1)].string); ;}
+  case 63: /* value: STRING  */
+#line 562 "SqlParser.y"
+                 { (yyval.string) = (yyvsp[0].string); }
+#line 1982 "SqlParser.tab.c"
     break;
 
-  case 23:
-#line 140 "SqlParser.y"
-    { (yyval.string) = (yyvsp[(1) - (1)].string); ;}
+  case 64: /* table: ID  */
+#line 566 "SqlParser.y"
+           { (yyval.string) = (yyvsp[0].string); }
+#line 1988 "SqlParser.tab.c"
     break;
 
-  case 24:
-#line 144 "SqlParser.y"
-    { (yyval.integer) = SelCond::EQ; ;}
+  case 65: /* comparator: EQUAL  */
+#line 570 "SqlParser.y"
+                       { (yyval.integer) = SelCond::EQ; }
+#line 1994 "SqlParser.tab.c"
     break;
 
-  case 25:
-#line 145 "SqlParser.y"
-    { (yyval.integer) = SelCond::NE; ;}
+  case 66: /* comparator: NEQUAL  */
+#line 571 "SqlParser.y"
+                       { (yyval.integer) = SelCond::NE; }
+#line 2000 "SqlParser.tab.c"
     break;
 
-  case 26:
-#line 146 "SqlParser.y"
-    { (yyval.integer) = SelCond::LT; ;}
+  case 67: /* comparator: LESS  */
+#line 572 "SqlParser.y"
+                       { (yyval.integer) = SelCond::LT; }
+#line 2006 "SqlParser.tab.c"
     break;
 
-  case 27:
-#line 147 "SqlParser.y"
-    { (yyval.integer) = SelCond::GT; ;}
+  case 68: /* comparator: GREATER  */
+#line 573 "SqlParser.y"
+                       { (yyval.integer) = SelCond::GT; }
+#line 2012 "SqlParser.tab.c"
     break;
 
-  case 28:
-#line 148 "SqlParser.y"
-    { (yyval.integer) = SelCond::LE; ;}
+  case 69: /* comparator: LESSEQUAL  */
+#line 574 "SqlParser.y"
+                       { (yyval.integer) = SelCond::LE; }
+#line 2018 "SqlParser.tab.c"
     break;
 
-  case 29:
-#line 149 "SqlParser.y"
-    { (yyval.integer) = SelCond::GE; ;}
+  case 70: /* comparator: GREATEREQUAL  */
+#line 575 "SqlParser.y"
+                       { (yyval.integer) = SelCond::GE; }
+#line 2024 "SqlParser.tab.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 1590 "SqlParser.tab.c"
+#line 2028 "SqlParser.tab.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -1688,14 +2102,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -1708,42 +2121,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -1754,50 +2167,53 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
 
+  return yyresult;
+}
 
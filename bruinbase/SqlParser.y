@@ -1,30 +1,229 @@
 %{
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <sys/times.h>
+#include <unistd.h>
 #include <climits>
 #include <string>
 #include "Bruinbase.h"
 #include "SqlEngine.h" 
 #include "PageFile.h"
+#include "ThreadPool.h"
 
 int  sqllex(void);  
+extern FILE* sqlin;
 void sqlerror(const char *str) { fprintf(stderr, "Error: %s\n", str); }
 extern "C" { int  sqlwrap() { return 1; } }
 
-static void runSelect(int attr, const char* table, const std::vector<SelCond>& conds)
-{
-  struct tms tmsbuf;
-  clock_t btime, etime;
-  int     bpagecnt, epagecnt;
+typedef std::vector<std::vector<SelCond> > Disjunction;
+
+static struct tms tmsbuf;
+static clock_t btime;
+static int     bpagecnt;
+static long    btaskcnt, bstealcnt, btasktime;
 
+static void startTimer()
+{
   btime = times(&tmsbuf);
   bpagecnt = PageFile::getPageReadCount();
-  SqlEngine::select(attr, table, conds);
-  etime = times(&tmsbuf);
-  epagecnt = PageFile::getPageReadCount();
+  btaskcnt = ThreadPool::getTaskCount();
+  bstealcnt = ThreadPool::getStealCount();
+  btasktime = ThreadPool::getTaskTime();
+}
+
+static void stopTimer()
+{
+  clock_t etime = times(&tmsbuf);
+  int     epagecnt = PageFile::getPageReadCount();
+  long    etaskcnt = ThreadPool::getTaskCount();
 
   fprintf(stderr, "  -- %.3f seconds to run the select command. Read %d pages\n", ((float)(etime - btime))/sysconf(_SC_CLK_TCK), epagecnt - bpagecnt);
+  if (etaskcnt > btaskcnt) {
+    fprintf(stderr, "  -- %ld tasks on %d threads (%ld stolen), %.3f seconds of task time\n", etaskcnt - btaskcnt, SqlEngine::getThreads(), ThreadPool::getStealCount() - bstealcnt, (ThreadPool::getTaskTime() - btasktime) / 1e6);
+  }
+}
+
+// the SELECT clause is encoded as (column << 8) | (function << 4) | attr:
+// column is the GROUP BY attribute in front of an aggregate (0 if none),
+// and function is the aggregate function numbered as in
+// SelectOptions::Aggregate
+static int selectAttr(int list)
+{
+  return list & 0xf;
+}
+
+// the aggregate function and the GROUP BY, ORDER BY and LIMIT clauses.
+// list is the SELECT clause, group is the attribute in GROUP BY (0 if
+// none), order is the attribute in ORDER BY, negative if the order is
+// descending (0 if there is no ORDER BY), and limit is -1 if there is no
+// LIMIT. returns false if the clauses do not fit together.
+static bool selectOptions(int list, int group, int order, int limit, SelectOptions& options)
+{
+  int attr = selectAttr(list);
+  int column = list >> 8;
+  options.aggregate = static_cast<SelectOptions::Aggregate>((list >> 4) & 0xf);
+  options.groupAttr = group;
+  options.showGroup = (column != 0);
+  options.orderAttr = (order < 0) ? -order : order;
+  options.desc = (order < 0);
+  options.limit = limit;
+
+  if (group == 0) {
+    if (column != 0) {
+      sqlerror("a column in front of an aggregate needs GROUP BY");
+      return false;
+    }
+    return true;
+  }
+  if (column != 0 && column != group) {
+    sqlerror("the column in front of the aggregate must be the GROUP BY attribute");
+    return false;
+  }
+  if (attr == 3 || (options.aggregate == SelectOptions::NONE && attr != 4 && attr != group)) {
+    sqlerror("with GROUP BY, select the GROUP BY attribute or an aggregate");
+    return false;
+  }
+  if (options.orderAttr != 0 && options.orderAttr != group) {
+    sqlerror("with GROUP BY, ORDER BY must be on the GROUP BY attribute");
+    return false;
+  }
+  return true;
+}
+
+static void runSelect(int list, const char* table, const Disjunction& conds, int group, int order, int limit)
+{
+  SelectOptions options;
+  if (!selectOptions(list, group, order, limit, options)) return;
+  startTimer();
+  SqlEngine::select(selectAttr(list), table, conds, options);
+  stopTimer();
+}
+
+static void runExplain(int list, const char* table, const Disjunction& conds, int group, int order, int limit)
+{
+  SelectOptions options;
+  if (!selectOptions(list, group, order, limit, options)) return;
+  SqlEngine::explain(selectAttr(list), table, conds, options);
+}
+
+// a join whose WHERE clause had an error is not run
+static void runJoin(const JoinQuery& query)
+{
+  if (!query.valid) return;
+  startTimer();
+  SqlEngine::join(query);
+  stopTimer();
+}
+
+static void runExplainJoin(const JoinQuery& query)
+{
+  if (!query.valid) return;
+  SqlEngine::explainJoin(query);
+}
+
+// complete the SELECT clause of a join: * selects all columns of both
+// tables, COUNT(*) none. returns false if attr is an unqualified column.
+static bool setJoinColumns(JoinQuery* query, int attr)
+{
+  if (attr > 4) {
+    sqlerror("aggregate functions are not supported in a join");
+    return false;
+  }
+  if (attr == 1 || attr == 2) {
+    sqlerror("ambiguous attribute in a join. use table.key or table.value");
+    return false;
+  }
+  query->columns.clear();
+  for (int i = 0; i < 2 && attr == 3; i++) {
+    JoinColumn c;
+    c.table = query->table[i];
+    c.attr = 1;
+    query->columns.push_back(c);
+    c.attr = 2;
+    query->columns.push_back(c);
+  }
+  return true;
+}
+
+// free a join query and its condition values
+static void freeJoin(JoinQuery* query)
+{
+  for (unsigned i = 0; i < query->conds.size(); i++) {
+    free(query->conds[i].value);
+  }
+  delete query;
+}
+
+static JoinQuery* addJoinCond(JoinQuery* query, JoinColumn* column, int comp, char* value)
+{
+  if (query == NULL) {
+    query = new JoinQuery;
+    query->joined[0].attr = 0;
+    query->valid = true;
+  }
+  JoinCond c;
+  c.column = *column;
+  c.comp = static_cast<SelCond::Comparator>(comp);
+  c.value = value;
+  query->conds.push_back(c);
+  delete column;
+  return query;
+}
+
+static JoinQuery* addJoinColumns(JoinQuery* query, JoinColumn* left, JoinColumn* right)
+{
+  if (query == NULL) {
+    query = new JoinQuery;
+    query->joined[0].attr = 0;
+    query->valid = true;
+  }
+  if (query->joined[0].attr != 0) {
+    sqlerror("only one join condition between the tables is supported");
+    query->valid = false;
+  } else {
+    query->joined[0] = *left;
+    query->joined[1] = *right;
+  }
+  delete left;
+  delete right;
+  return query;
+}
+
+// free the condition values of a WHERE clause
+static void freeConds(Disjunction* conds)
+{
+  for (unsigned i = 0; i < conds->size(); i++) {
+    for (unsigned j = 0; j < (*conds)[i].size(); j++) {
+      free((*conds)[i][j].value);
+    }
+  }
+  delete conds;
+}
+
+// AND a list of alternative conditions (a single condition, or the
+// equalities of an IN list) to every conjunction of a WHERE clause.
+// every conjunction gets its own copy of the condition values.
+static Disjunction* andConds(Disjunction* conds, std::vector<SelCond>* alts)
+{
+  Disjunction* result = new Disjunction;
+  for (unsigned i = 0; i < conds->size(); i++) {
+    for (unsigned j = 0; j < alts->size(); j++) {
+      std::vector<SelCond> conj = (*conds)[i];
+      for (unsigned k = 0; k < conj.size(); k++) {
+        conj[k].value = strdup(conj[k].value);
+      }
+      conj.push_back((*alts)[j]);
+      conj.back().value = strdup(conj.back().value);
+      result->push_back(conj);
+    }
+  }
+  freeConds(conds);
+  for (unsigned j = 0; j < alts->size(); j++) {
+    free((*alts)[j].value);
+  }
+  delete alts;
+  return result;
 }
 
 %}
@@ -32,19 +231,27 @@ static void runSelect(int attr, const char* table, const std::vector<SelCond>& c
 %union {
   int integer;
   char* string;
-  SelCond* cond;
   std::vector<SelCond>* conds;
+  std::vector<std::vector<SelCond> >* disjunction;
+  JoinColumn* column;
+  std::vector<JoinColumn>* columns;
+  JoinQuery* join;
 }
 
-%token SELECT FROM WHERE LOAD WITH INDEX QUIT COUNT AND OR 
-%token COMMA STAR LF
+%token SELECT FROM WHERE LOAD WITH INDEX QUIT COUNT AND OR EXPLAIN ANALYZE
+%token ORDER GROUP BY ASC DESC LIMIT SET COPY TO
+%token <integer> AGGREGATE
+%token IN LPAREN RPAREN COMMA DOT STAR LF
 %token <string> INTEGER STRING ID
 %token EQUAL NEQUAL LESS LESSEQUAL GREATER GREATEREQUAL 
 
-%type <integer> attributes attribute comparator
+%type <integer> select_list attributes attribute comparator group_clause order_clause limit_clause
 %type <string> table value
-%type <cond> condition
-%type <conds> conditions
+%type <conds> condition values
+%type <disjunction> conditions conjunction
+%type <column> column
+%type <columns> columns
+%type <join> join_clause join_conditions
 %%
 
 commands:
@@ -55,11 +262,62 @@ commands:
 command:
         load_command { fprintf(stdout, "Bruinbase> "); }
 	| select_command { fprintf(stdout, "Bruinbase> "); }
+	| explain_command { fprintf(stdout, "Bruinbase> "); }
+	| analyze_command { fprintf(stdout, "Bruinbase> "); }
+	| set_command { fprintf(stdout, "Bruinbase> "); }
+	| copy_command { fprintf(stdout, "Bruinbase> "); }
 	| quit_command
 	| error LF { fprintf(stdout, "Bruinbase> "); }
 	| LF { fprintf(stdout, "Bruinbase> "); }
 	;
 
+set_command:
+	SET ID INTEGER LF {
+	  if (strcmp($2, "threads") == 0) {
+	    SqlEngine::setThreads(atoi($3));
+	  } else {
+	    sqlerror("unknown setting. try SET THREADS n");
+	  }
+	  free($2);
+	  free($3);
+	}
+	| SET ID ID LF {
+	  if (strcmp($2, "storage") == 0) {
+	    if (strcmp($3, "compressed") == 0) {
+	      SqlEngine::setTableStorage(RecordFile::COMPRESSED);
+	    } else if (strcmp($3, "columnar") == 0) {
+	      SqlEngine::setTableStorage(RecordFile::COLUMNAR);
+	    } else if (strcmp($3, "plain") == 0) {
+	      SqlEngine::setTableStorage(RecordFile::PLAIN);
+	    } else {
+	      sqlerror("unknown storage. try SET STORAGE compressed|columnar|plain");
+	    }
+	  } else if (strcmp($2, "output") != 0) {
+	    sqlerror("unknown setting. try SET OUTPUT text|tsv|binary");
+	  } else if (strcmp($3, "text") == 0) {
+	    SqlEngine::setOutputFormat(ResultSink::TEXT);
+	  } else if (strcmp($3, "tsv") == 0) {
+	    SqlEngine::setOutputFormat(ResultSink::TSV);
+	  } else if (strcmp($3, "binary") == 0) {
+	    SqlEngine::setOutputFormat(ResultSink::BINARY);
+	  } else {
+	    sqlerror("unknown output format. try text, tsv or binary");
+	  }
+	  free($2);
+	  free($3);
+	}
+	| SET INDEX ID LF {
+	  if (strcmp($3, "compressed") == 0) {
+	    SqlEngine::setIndexCompression(true);
+	  } else if (strcmp($3, "plain") == 0) {
+	    SqlEngine::setIndexCompression(false);
+	  } else {
+	    sqlerror("unknown index format. try SET INDEX compressed|plain");
+	  }
+	  free($3);
+	}
+	;
+
 quit_command:
 	QUIT { return 0; }
 	;
@@ -75,52 +333,220 @@ load_command:
 	  free($2);
 	  free($4);
 	}
+	| LOAD table FROM ID LF {
+	  if (strcmp($4, "stdin") == 0) {
+	    SqlEngine::load(std::string($2), sqlin, false);
+	  } else {
+	    sqlerror("unknown load source. try LOAD table FROM 'file' or FROM STDIN");
+	  }
+	  free($2);
+	  free($4);
+	}
+	| LOAD table FROM ID WITH INDEX LF {
+	  if (strcmp($4, "stdin") == 0) {
+	    SqlEngine::load(std::string($2), sqlin, true);
+	  } else {
+	    sqlerror("unknown load source. try LOAD table FROM 'file' or FROM STDIN");
+	  }
+	  free($2);
+	  free($4);
+	}
+	;
+
+copy_command:
+	COPY table TO STRING LF {
+	  SqlEngine::copy(std::string($2), std::string($4));
+	  free($2);
+	  free($4);
+	}
+	;
+
+analyze_command:
+	ANALYZE table LF {
+	  SqlEngine::analyze(std::string($2));
+	  free($2);
+	}
 	;
 
 select_command:
-	SELECT attributes FROM table LF {
-   	        std::vector<SelCond> conds;
-		runSelect($2, $4, conds);
+	SELECT select_list FROM table group_clause order_clause limit_clause LF {
+   	        Disjunction conds(1);
+		runSelect($2, $4, conds, $5, $6, $7);
 		free($4);
 	}
-	| SELECT attributes FROM table WHERE conditions LF {
-	        runSelect($2, $4, *$6);
+	| SELECT select_list FROM table WHERE conditions group_clause order_clause limit_clause LF {
+	        runSelect($2, $4, *$6, $7, $8, $9);
 	  	free($4);
-	  	for (unsigned i = 0; i < $6->size(); i++) {
-		    free((*$6)[i].value);
-		}
-	  	delete $6;
+	  	freeConds($6);
+	}
+	| SELECT select_list join_clause LF {
+		if (setJoinColumns($3, $2)) runJoin(*$3);
+		freeJoin($3);
+	}
+	| SELECT columns join_clause LF {
+		$3->columns = *$2;
+		runJoin(*$3);
+		delete $2;
+		freeJoin($3);
 	}
 	;
 
-conditions:
-	condition {
-	  std::vector<SelCond>* v = new std::vector<SelCond>;
-	  v->push_back(*$1);
-	  $$ = v;
-          delete $1;
+explain_command:
+	EXPLAIN SELECT select_list FROM table group_clause order_clause limit_clause LF {
+   	        Disjunction conds(1);
+		runExplain($3, $5, conds, $6, $7, $8);
+		free($5);
+	}
+	| EXPLAIN SELECT select_list FROM table WHERE conditions group_clause order_clause limit_clause LF {
+	        runExplain($3, $5, *$7, $8, $9, $10);
+	  	free($5);
+	  	freeConds($7);
+	}
+	| EXPLAIN SELECT select_list join_clause LF {
+		if (setJoinColumns($4, $3)) runExplainJoin(*$4);
+		freeJoin($4);
 	}
-	| conditions AND condition {
+	| EXPLAIN SELECT columns join_clause LF {
+		$4->columns = *$3;
+		runExplainJoin(*$4);
+		delete $3;
+		freeJoin($4);
+	}
+	;
+
+join_clause:
+	FROM table COMMA table WHERE join_conditions {
+	  $6->table[0] = $2;
+	  $6->table[1] = $4;
+	  free($2);
+	  free($4);
+	  $$ = $6;
+	}
+	;
+
+join_conditions:
+	column comparator value { $$ = addJoinCond(NULL, $1, $2, $3); }
+	| column EQUAL column { $$ = addJoinColumns(NULL, $1, $3); }
+	| join_conditions AND column comparator value { $$ = addJoinCond($1, $3, $4, $5); }
+	| join_conditions AND column EQUAL column { $$ = addJoinColumns($1, $3, $5); }
+	;
+
+columns:
+	column {
+	  $$ = new std::vector<JoinColumn>(1, *$1);
+	  delete $1;
+	}
+	| columns COMMA column {
 	  $1->push_back(*$3);
 	  $$ = $1;
-          delete $3;
+	  delete $3;
+	}
+	;
+
+column:
+	table DOT attribute {
+	  $$ = new JoinColumn;
+	  $$->table = $1;
+	  $$->attr = $3;
+	  free($1);
+	}
+	;
+
+conditions:
+	conjunction { $$ = $1; }
+	| conditions OR conjunction {
+	  $1->insert($1->end(), $3->begin(), $3->end());
+	  $$ = $1;
+	  delete $3;
+	}
+	;
+
+conjunction:
+	condition {
+	  Disjunction* d = new Disjunction;
+	  for (unsigned i = 0; i < $1->size(); i++) {
+	    d->push_back(std::vector<SelCond>(1, (*$1)[i]));
+	  }
+	  $$ = d;
+	  delete $1;
+	}
+	| conjunction AND condition {
+	  $$ = andConds($1, $3);
 	}
 	;
 
 condition:
 	attribute comparator value { 
-	  SelCond* c = new SelCond;
-	  c->attr = $1;
-	  c->comp = static_cast<SelCond::Comparator>($2);
-	  c->value = $3;
-	  $$ = c;
+	  SelCond c;
+	  c.attr = $1;
+	  c.comp = static_cast<SelCond::Comparator>($2);
+	  c.value = $3;
+	  $$ = new std::vector<SelCond>(1, c);
         }
+	| attribute IN LPAREN values RPAREN {
+	  for (unsigned i = 0; i < $4->size(); i++) {
+	    (*$4)[i].attr = $1;
+	  }
+	  $$ = $4;
+	}
+	;
+
+values:
+	value {
+	  SelCond c;
+	  c.comp = SelCond::EQ;
+	  c.value = $1;
+	  $$ = new std::vector<SelCond>(1, c);
+	}
+	| values COMMA value {
+	  SelCond c;
+	  c.comp = SelCond::EQ;
+	  c.value = $3;
+	  $1->push_back(c);
+	  $$ = $1;
+	}
+	;
+
+group_clause:
+	/* empty */ { $$ = 0; }
+	| GROUP BY attribute { $$ = $3; }
+	;
+
+order_clause:
+	/* empty */ { $$ = 0; }
+	| ORDER BY attribute { $$ = $3; }
+	| ORDER BY attribute ASC { $$ = $3; }
+	| ORDER BY attribute DESC { $$ = -$3; }
+	;
+
+limit_clause:
+	/* empty */ { $$ = -1; }
+	| LIMIT INTEGER {
+		$$ = atoi($2);
+		if ($$ < 0) {
+			sqlerror("LIMIT must not be negative");
+			$$ = 0;
+		}
+		free($2);
+	}
+	;
+
+select_list:
+	attributes { $$ = $1; }
+	| attribute COMMA attributes { $$ = ($1 << 8) | $3; }
 	;
 
 attributes:
 	attribute { $$ = $1; }
 	| STAR  { $$ = 3; }
 	| COUNT { $$ = 4; }
+	| AGGREGATE LPAREN attribute RPAREN {
+		if ($1 >= SelectOptions::SUM && $3 != 1) {
+			sqlerror("SUM and AVG apply to the key column only");
+			YYERROR;
+		}
+		$$ = ($1 << 4) | $3;
+	}
 	;
 
 attribute:
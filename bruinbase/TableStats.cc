@@ -0,0 +1,218 @@
+/**
+ * TableStats: statistics of a table used for query planning.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include "TableStats.h"
+
+using std::string;
+
+// scramble the bits of a 64-bit integer (the finalizer of splitmix64)
+static unsigned long long mix64(unsigned long long x)
+{
+  x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+// 64-bit FNV-1a hash of a string
+static unsigned long long hashString(const string& s)
+{
+  unsigned long long h = 0xcbf29ce484222325ULL;
+  for (unsigned i = 0; i < s.size(); i++) {
+    h ^= (unsigned char)s[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+TableStats::TableStats()
+{
+  rowCount = 0;
+  pageCount = 0;
+  minKey = INT_MAX;
+  maxKey = INT_MIN;
+  valueLength = 0;
+  sampleCount = 0;
+  memset(bounds, 0, sizeof(bounds));
+  memset(keySketch, 0, sizeof(keySketch));
+  memset(valueSketch, 0, sizeof(valueSketch));
+}
+
+//
+// layout of the statistics file:
+//   page 0: rowCount, pageCount, minKey, maxKey, sampleCount,
+//           valueLength (8 bytes), histogram bounds
+//   page 1: the key sample
+//   page 2: the distinct-key sketch
+//   page 3: the distinct-value sketch
+//
+RC TableStats::open(const string& table)
+{
+  RC       rc;
+  PageFile pf;
+  char     page[PageFile::PAGE_SIZE];
+  int*     ptr = (int*)page;
+
+  if ((rc = pf.open(table + ".sts", 'r')) < 0) return rc;
+  if (pf.endPid() < 4) {
+    pf.close();
+    return RC_INVALID_FILE_FORMAT;
+  }
+
+  if ((rc = pf.read(0, page)) < 0) goto exit_open;
+  rowCount = *ptr++;
+  pageCount = *ptr++;
+  minKey = *ptr++;
+  maxKey = *ptr++;
+  sampleCount = *ptr++;
+  memcpy(&valueLength, ptr, sizeof(valueLength));
+  ptr += sizeof(valueLength) / sizeof(int);
+  memcpy(bounds, ptr, sizeof(bounds));
+
+  if ((rc = pf.read(1, page)) < 0) goto exit_open;
+  memcpy(sample, page, sizeof(sample));
+
+  if ((rc = pf.read(2, keySketch)) < 0) goto exit_open;
+  rc = pf.read(3, valueSketch);
+
+  exit_open:
+  pf.close();
+  return rc;
+}
+
+RC TableStats::save(const string& table, int pages)
+{
+  RC       rc;
+  PageFile pf;
+  char     page[PageFile::PAGE_SIZE];
+  int*     ptr = (int*)page;
+
+  pageCount = pages;
+  buildHistogram();
+
+  if ((rc = pf.open(table + ".sts", 'w')) < 0) return rc;
+
+  memset(page, 0, PageFile::PAGE_SIZE);
+  *ptr++ = rowCount;
+  *ptr++ = pageCount;
+  *ptr++ = minKey;
+  *ptr++ = maxKey;
+  *ptr++ = sampleCount;
+  memcpy(ptr, &valueLength, sizeof(valueLength));
+  ptr += sizeof(valueLength) / sizeof(int);
+  memcpy(ptr, bounds, sizeof(bounds));
+  if ((rc = pf.write(0, page)) < 0) goto exit_save;
+
+  memset(page, 0, PageFile::PAGE_SIZE);
+  memcpy(page, sample, sampleCount * sizeof(int));
+  if ((rc = pf.write(1, page)) < 0) goto exit_save;
+
+  if ((rc = pf.write(2, keySketch)) < 0) goto exit_save;
+  rc = pf.write(3, valueSketch);
+
+  exit_save:
+  pf.close();
+  return rc;
+}
+
+void TableStats::add(int key, const string& value)
+{
+  if (key < minKey) minKey = key;
+  if (key > maxKey) maxKey = key;
+  valueLength += value.size();
+
+  // reservoir sampling: the i'th key replaces a random sample slot
+  // with probability SAMPLE_SIZE/i, so that every key in the table
+  // is equally likely to be in the sample
+  if (sampleCount < SAMPLE_SIZE) {
+    sample[sampleCount++] = key;
+  } else {
+    int slot = rand() % (rowCount + 1);
+    if (slot < SAMPLE_SIZE) sample[slot] = key;
+  }
+
+  addToSketch(keySketch, mix64((unsigned)key));
+  addToSketch(valueSketch, mix64(hashString(value)));
+
+  rowCount++;
+}
+
+void TableStats::buildHistogram()
+{
+  if (sampleCount == 0) return;
+
+  // the bucket boundaries are evenly spaced quantiles of the sample
+  int sorted[SAMPLE_SIZE];
+  memcpy(sorted, sample, sampleCount * sizeof(int));
+  std::sort(sorted, sorted + sampleCount);
+
+  for (int i = 0; i <= HISTOGRAM_BUCKETS; i++) {
+    bounds[i] = sorted[(long long)i * (sampleCount - 1) / HISTOGRAM_BUCKETS];
+  }
+  bounds[0] = minKey;
+  bounds[HISTOGRAM_BUCKETS] = maxKey;
+}
+
+double TableStats::estimateRows(int low, int high) const
+{
+  if (rowCount == 0 || sampleCount == 0) return 0;
+
+  // nothing outside of [minKey, maxKey]
+  if (low < minKey) low = minKey;
+  if (high > maxKey) high = maxKey;
+  if (low > high) return 0;
+
+  // a single key: assume that all distinct keys are equally frequent
+  if (low == high) {
+    double distinct = getDistinctKeys();
+    return rowCount / (distinct < 1 ? 1 : distinct);
+  }
+
+  // every bucket holds the same # keys, and we assume that the keys
+  // are uniformly distributed inside a bucket
+  double perBucket = (double)rowCount / HISTOGRAM_BUCKETS;
+  double rows = 0;
+  for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+    double bl = bounds[b], bh = bounds[b + 1];
+    double lo = (low > bl ? low : bl), hi = (high < bh ? high : bh);
+    if (lo <= hi) rows += perBucket * (hi - lo + 1) / (bh - bl + 1);
+  }
+
+  return (rows > rowCount ? rowCount : rows);
+}
+
+void TableStats::addToSketch(unsigned char* sketch, unsigned long long hash)
+{
+  // the first 10 bits of the hash pick the register, and the register
+  // remembers the longest run of leading zeros seen in the other bits
+  int reg = (int)(hash >> 54);
+  unsigned long long rest = hash << 10;
+  unsigned char rank = (rest == 0) ? 55 : __builtin_clzll(rest) + 1;
+  if (rank > sketch[reg]) sketch[reg] = rank;
+}
+
+double TableStats::estimateDistinct(const unsigned char* sketch, int items)
+{
+  const double m = SKETCH_REGISTERS;
+  double sum = 0;
+  int    zeros = 0;
+
+  for (int i = 0; i < SKETCH_REGISTERS; i++) {
+    sum += ldexp(1.0, -sketch[i]);
+    if (sketch[i] == 0) zeros++;
+  }
+
+  double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+
+  // use linear counting while many registers are still empty
+  if (estimate <= 2.5 * m && zeros > 0)
+    estimate = m * log(m / zeros);
+
+  return (estimate < items) ? estimate : items;
+}
@@ -0,0 +1,113 @@
+/**
+ * TableStats keeps the statistics of a table that the query planner
+ * uses to estimate the cost of the different access paths.
+ * The statistics are maintained while the table is loaded (and can be
+ * rebuilt from the table with ANALYZE) and are stored in the file
+ * "<table>.sts".
+ */
+
+#ifndef TABLESTATS_H
+#define TABLESTATS_H
+
+#include <string>
+#include "Bruinbase.h"
+#include "PageFile.h"
+
+class TableStats {
+ public:
+
+  // number of buckets in the equi-depth key histogram
+  static const int HISTOGRAM_BUCKETS = 32;
+
+  // number of keys kept in the random sample of the key column
+  static const int SAMPLE_SIZE = PageFile::PAGE_SIZE / sizeof(int);
+
+  // number of HyperLogLog registers of a distinct-count sketch
+  static const int SKETCH_REGISTERS = PageFile::PAGE_SIZE;
+
+  TableStats();
+
+  /**
+   * read the statistics of a table from its statistics file.
+   * @param table[IN] the table name
+   * @return error code. 0 if no error (RC_FILE_OPEN_FAILED if the table
+   * has no statistics)
+   */
+  RC open(const std::string& table);
+
+  /**
+   * write the statistics of a table to its statistics file.
+   * the key histogram is rebuilt from the key sample before it is written.
+   * @param table[IN] the table name
+   * @param pageCount[IN] the number of pages in the table file
+   * @return error code. 0 if no error
+   */
+  RC save(const std::string& table, int pageCount);
+
+  /**
+   * account for a new tuple in the statistics.
+   * @param key[IN] the key of the tuple
+   * @param value[IN] the value of the tuple
+   */
+  void add(int key, const std::string& value);
+
+  /**
+   * estimate the number of tuples whose key is in the range [low, high].
+   * @param low[IN] the lower bound of the range (inclusive)
+   * @param high[IN] the upper bound of the range (inclusive)
+   * @return the estimated number of tuples
+   */
+  double estimateRows(int low, int high) const;
+
+  /**
+   * @return the estimated number of distinct keys in the table (at most
+   * the number of tuples)
+   */
+  double getDistinctKeys() const { return estimateDistinct(keySketch, rowCount); }
+
+  /**
+   * @return the estimated number of distinct values in the table (at most
+   * the number of tuples)
+   */
+  double getDistinctValues() const { return estimateDistinct(valueSketch, rowCount); }
+
+  /**
+   * @return the average length of the value column
+   */
+  double getAvgValueLength() const
+    { return rowCount > 0 ? (double)valueLength / rowCount : 0; }
+
+  int getRowCount() const  { return rowCount; }
+  int getPageCount() const { return pageCount; }
+  int getMinKey() const    { return minKey; }
+  int getMaxKey() const    { return maxKey; }
+
+ private:
+  // rebuild the equi-depth histogram from the key sample
+  void buildHistogram();
+
+  // HyperLogLog estimate of the # distinct items added to a sketch, which
+  // cannot be more than the # items added
+  static double estimateDistinct(const unsigned char* sketch, int items);
+
+  // add a 64-bit hash to a sketch
+  static void addToSketch(unsigned char* sketch, unsigned long long hash);
+
+  int rowCount;     // # tuples in the table
+  int pageCount;    // # pages in the table file
+  int minKey;       // the smallest key in the table
+  int maxKey;       // the largest key in the table
+  long long valueLength;  // total length of the value column
+
+  // the bucket boundaries of the equi-depth histogram: each bucket
+  // [bounds[i], bounds[i+1]] holds about rowCount/HISTOGRAM_BUCKETS keys
+  int bounds[HISTOGRAM_BUCKETS + 1];
+
+  int sampleCount;          // # keys in the sample
+  int sample[SAMPLE_SIZE];  // reservoir sample of the key column
+
+  unsigned char keySketch[SKETCH_REGISTERS];    // distinct keys
+  unsigned char valueSketch[SKETCH_REGISTERS];  // distinct values
+};
+
+#endif // TABLESTATS_H
@@ -0,0 +1,161 @@
+/**
+ * ThreadPool: a fixed set of worker threads with work-stealing deques.
+ */
+
+#include <sys/time.h>
+#include "ThreadPool.h"
+
+long ThreadPool::taskCount = 0;
+long ThreadPool::stealCount = 0;
+long ThreadPool::taskTime = 0;
+
+// the worker that runs on the current thread (NULL outside any pool)
+static __thread void* currentWorker = NULL;
+
+ThreadPool::ThreadPool(int workers)
+{
+  pthread_mutex_init(&lock, NULL);
+  pthread_cond_init(&ready, NULL);
+  queued = 0;
+  stopping = false;
+  nextWorker = 0;
+
+  if (workers < 1) workers = 1;
+
+  // all deques exist before any worker starts stealing from them
+  for (int i = 0; i < workers; i++) {
+    Worker* w = new Worker;
+    w->pool = this;
+    w->id = i;
+    pthread_mutex_init(&w->lock, NULL);
+    this->workers.push_back(w);
+  }
+  for (int i = 0; i < workers; i++) {
+    if (pthread_create(&this->workers[i]->thread, NULL, work, this->workers[i]) != 0) {
+      // run with the workers that could be started
+      for (int j = i; j < workers; j++) {
+        pthread_mutex_destroy(&this->workers[j]->lock);
+        delete this->workers[j];
+      }
+      this->workers.resize(i);
+      break;
+    }
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  pthread_mutex_lock(&lock);
+  stopping = true;
+  pthread_cond_broadcast(&ready);
+  pthread_mutex_unlock(&lock);
+
+  for (unsigned i = 0; i < workers.size(); i++) {
+    pthread_join(workers[i]->thread, NULL);
+  }
+  for (unsigned i = 0; i < workers.size(); i++) {
+    pthread_mutex_destroy(&workers[i]->lock);
+    delete workers[i];
+  }
+  pthread_cond_destroy(&ready);
+  pthread_mutex_destroy(&lock);
+}
+
+void ThreadPool::submit(Task task, void* arg)
+{
+  Job job;
+  job.task = task;
+  job.arg = arg;
+
+  // without a worker thread, run the task right away
+  if (workers.empty()) {
+    runJob(job);
+    return;
+  }
+
+  // a worker of this pool keeps its own tasks; the tasks from outside
+  // are dealt to the workers in turn. the job is counted as queued
+  // together with its push, so a worker that sees it queued finds it
+  Worker* w = (Worker*)currentWorker;
+  pthread_mutex_lock(&lock);
+  if (w == NULL || w->pool != this) {
+    w = workers[nextWorker++ % workers.size()];
+  }
+  pthread_mutex_lock(&w->lock);
+  w->jobs.push_back(job);
+  pthread_mutex_unlock(&w->lock);
+  queued++;
+  pthread_cond_signal(&ready);
+  pthread_mutex_unlock(&lock);
+}
+
+bool ThreadPool::takeJob(Worker* worker, Job& job)
+{
+  // the most recent job of the worker's own deque
+  pthread_mutex_lock(&worker->lock);
+  if (!worker->jobs.empty()) {
+    job = worker->jobs.back();
+    worker->jobs.pop_back();
+    pthread_mutex_unlock(&worker->lock);
+    return true;
+  }
+  pthread_mutex_unlock(&worker->lock);
+
+  // the oldest job of another deque, starting from the next worker
+  for (unsigned i = 1; i < workers.size(); i++) {
+    Worker* victim = workers[(worker->id + i) % workers.size()];
+    pthread_mutex_lock(&victim->lock);
+    if (!victim->jobs.empty()) {
+      job = victim->jobs.front();
+      victim->jobs.pop_front();
+      pthread_mutex_unlock(&victim->lock);
+      __sync_fetch_and_add(&stealCount, 1);
+      return true;
+    }
+    pthread_mutex_unlock(&victim->lock);
+  }
+  return false;
+}
+
+void ThreadPool::runJob(const Job& job)
+{
+  struct timeval start, end;
+
+  gettimeofday(&start, NULL);
+  job.task(job.arg);
+  gettimeofday(&end, NULL);
+
+  __sync_fetch_and_add(&taskCount, 1);
+  __sync_fetch_and_add(&taskTime, (end.tv_sec - start.tv_sec) * 1000000L + (end.tv_usec - start.tv_usec));
+}
+
+void* ThreadPool::work(void* arg)
+{
+  Worker*     w = (Worker*)arg;
+  ThreadPool* pool = w->pool;
+  Job         job;
+
+  currentWorker = w;
+  for (;;) {
+    // wait until there is a job somewhere. the queued jobs are run
+    // before the worker stops
+    pthread_mutex_lock(&pool->lock);
+    while (pool->queued == 0 && !pool->stopping) {
+      pthread_cond_wait(&pool->ready, &pool->lock);
+    }
+    if (pool->queued == 0) {
+      pthread_mutex_unlock(&pool->lock);
+      return NULL;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    // the job may have been taken by another worker meanwhile
+    if (!pool->takeJob(w, job)) continue;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->queued--;
+    pthread_mutex_unlock(&pool->lock);
+
+    runJob(job);
+  }
+}
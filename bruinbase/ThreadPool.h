@@ -0,0 +1,102 @@
+/**
+ * ThreadPool runs tasks on a fixed set of worker threads.
+ * A task is a function and its argument. Every worker has its own deque
+ * of tasks: a task submitted by a worker goes to the back of its own
+ * deque, and the worker takes its next task from there (the most recent
+ * one, whose data is likely still in its cache). Tasks submitted from
+ * outside the pool are dealt to the deques in turn. A worker whose deque
+ * is empty steals the oldest task from the front of another deque.
+ * The caller keeps track of the completion of its own tasks (e.g. with a
+ * flag and a condition variable in the argument).
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <deque>
+#include <vector>
+#include <pthread.h>
+
+class ThreadPool {
+ public:
+
+  // a task: a function that is called with its argument on a worker thread
+  typedef void (*Task)(void* arg);
+
+  /**
+   * start the worker threads.
+   * @param workers[IN] the # worker threads (at least 1)
+   */
+  ThreadPool(int workers);
+
+  /**
+   * run the tasks that are still queued and stop the worker threads.
+   */
+  ~ThreadPool();
+
+  /**
+   * queue a task to run on one of the worker threads.
+   * @param task[IN] the function to run
+   * @param arg[IN] the argument of the function
+   */
+  void submit(Task task, void* arg);
+
+  /**
+   * @return the # worker threads
+   */
+  int getWorkerCount() const { return workers.size(); }
+
+  /**
+   * @return the total # tasks run by all pools
+   */
+  static long getTaskCount() { return taskCount; }
+
+  /**
+   * @return the total # tasks that were stolen from another worker's deque
+   */
+  static long getStealCount() { return stealCount; }
+
+  /**
+   * @return the total time spent running tasks, in microseconds
+   */
+  static long getTaskTime() { return taskTime; }
+
+ private:
+  typedef struct {
+    Task  task;
+    void* arg;
+  } Job;
+
+  // a worker thread and its deque of jobs
+  typedef struct {
+    ThreadPool*     pool;
+    int             id;
+    pthread_t       thread;
+    pthread_mutex_t lock;   // protects jobs
+    std::deque<Job> jobs;
+  } Worker;
+
+  // the main loop of a worker thread
+  static void* work(void* worker);
+
+  // take a job from the back of the worker's own deque, or else steal
+  // one from the front of another deque. returns false if all are empty
+  bool takeJob(Worker* worker, Job& job);
+
+  // run a job and account for its time
+  static void runJob(const Job& job);
+
+  std::vector<Worker*> workers;
+
+  pthread_mutex_t lock;      // protects queued and stopping
+  pthread_cond_t  ready;     // signaled when a job is queued or on stop
+  int             queued;    // # jobs in all deques
+  bool            stopping;  // true once the pool is being destroyed
+  unsigned        nextWorker;  // the deque of the next job from outside
+
+  static long taskCount;   // total # tasks run
+  static long stealCount;  // total # tasks stolen
+  static long taskTime;    // total time running tasks in microseconds
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,191 @@
+/**
+ * ZoneMap: the per-zone key and value summaries of a table.
+ */
+
+#include <cstring>
+#include "ZoneMap.h"
+
+using std::string;
+
+ZoneMap::ZoneMap()
+{
+  zoneCount = 0;
+  tupleCount = 0;
+  firstDirty = 0;
+  writable = false;
+  opened = false;
+}
+
+RC ZoneMap::open(const string& filename, char mode)
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+
+  zones.clear();
+  zoneCount = tupleCount = 0;
+  if ((rc = pf.open(filename, mode)) < 0) return rc;
+  opened = true;
+  writable = (mode == 'w');
+
+  if (pf.endPid() > 0) {
+    if ((rc = pf.read(0, page)) < 0) goto exit_open;
+    memcpy(&zoneCount, page, sizeof(int));
+    memcpy(&tupleCount, page + sizeof(int), sizeof(int));
+    int zonePages = getZonePageCount();
+    if (zoneCount < 0 || tupleCount < 0 ||
+        1 + zonePages + (zonePages + ZONES_PER_PAGE - 1) / ZONES_PER_PAGE > pf.endPid()) {
+      // a zone map that is not well-formed is built again from scratch
+      zoneCount = tupleCount = 0;
+      if (!writable) {
+        rc = RC_INVALID_FILE_FORMAT;
+        goto exit_open;
+      }
+    }
+  }
+  firstDirty = zoneCount;
+
+  // the zones are appended to in memory
+  if (writable) {
+    zones.resize(zoneCount);
+    for (int i = 0; i < zoneCount; i += ZONES_PER_PAGE) {
+      if ((rc = pf.read(1 + i / ZONES_PER_PAGE, page)) < 0) goto exit_open;
+      int n = (zoneCount - i < ZONES_PER_PAGE) ? zoneCount - i : ZONES_PER_PAGE;
+      memcpy(&zones[i], page, n * sizeof(Zone));
+    }
+  }
+  return 0;
+
+  exit_open:
+  writable = false;
+  close();
+  return rc;
+}
+
+RC ZoneMap::close()
+{
+  RC   rc = 0;
+  char page[PageFile::PAGE_SIZE];
+
+  if (!opened) return 0;
+
+  // rewrite the pages from the one of the first zone that changed
+  if (writable) {
+    for (int i = firstDirty / ZONES_PER_PAGE * ZONES_PER_PAGE; i < zoneCount; i += ZONES_PER_PAGE) {
+      int n = (zoneCount - i < ZONES_PER_PAGE) ? zoneCount - i : ZONES_PER_PAGE;
+      memset(page, 0, PageFile::PAGE_SIZE);
+      memcpy(page, &zones[i], n * sizeof(Zone));
+      if ((rc = pf.write(1 + i / ZONES_PER_PAGE, page)) < 0) break;
+    }
+
+    // the summaries of the groups follow the zones, and are all written
+    // again since the zones may have moved them
+    int groups = getZonePageCount();
+    for (int i = 0; i < groups && rc == 0; i += ZONES_PER_PAGE) {
+      Zone* summaries = (Zone*)page;
+      memset(page, 0, PageFile::PAGE_SIZE);
+      for (int g = i; g < groups && g < i + ZONES_PER_PAGE; g++) {
+        summaries[g - i] = zones[g * ZONES_PER_PAGE];
+        for (int z = g * ZONES_PER_PAGE + 1; z < zoneCount && z < (g + 1) * ZONES_PER_PAGE; z++)
+          merge(summaries[g - i], zones[z]);
+      }
+      rc = pf.write(1 + groups + i / ZONES_PER_PAGE, page);
+    }
+
+    if (rc == 0) {
+      memset(page, 0, PageFile::PAGE_SIZE);
+      memcpy(page, &zoneCount, sizeof(int));
+      memcpy(page + sizeof(int), &tupleCount, sizeof(int));
+      rc = pf.write(0, page);
+    }
+  }
+
+  zones.clear();
+  zoneCount = tupleCount = 0;
+  firstDirty = 0;
+  writable = opened = false;
+  RC closed = pf.close();
+  return (rc < 0) ? rc : closed;
+}
+
+RC ZoneMap::getZone(int zone, Zone& summary) const
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+
+  if (zone < 0 || zone >= zoneCount) return RC_INVALID_PID;
+  if (writable) {
+    summary = zones[zone];
+    return 0;
+  }
+  if ((rc = pf.read(1 + zone / ZONES_PER_PAGE, page)) < 0) return rc;
+  memcpy(&summary, page + (zone % ZONES_PER_PAGE) * sizeof(Zone), sizeof(Zone));
+  return 0;
+}
+
+RC ZoneMap::getGroup(int zone, Zone& summary) const
+{
+  RC   rc;
+  char page[PageFile::PAGE_SIZE];
+  int  group = zone / ZONES_PER_PAGE;
+
+  if (zone < 0 || zone >= zoneCount) return RC_INVALID_PID;
+  if (writable) {
+    summary = zones[group * ZONES_PER_PAGE];
+    for (int z = group * ZONES_PER_PAGE + 1; z < zoneCount && z < (group + 1) * ZONES_PER_PAGE; z++)
+      merge(summary, zones[z]);
+    return 0;
+  }
+  if ((rc = pf.read(1 + getZonePageCount() + group / ZONES_PER_PAGE, page)) < 0) return rc;
+  memcpy(&summary, page + (group % ZONES_PER_PAGE) * sizeof(Zone), sizeof(Zone));
+  return 0;
+}
+
+void ZoneMap::merge(Zone& summary, const Zone& zone)
+{
+  if (zone.minKey < summary.minKey) summary.minKey = zone.minKey;
+  if (zone.maxKey > summary.maxKey) summary.maxKey = zone.maxKey;
+  if (memcmp(zone.minValue, summary.minValue, PREFIX_LENGTH) < 0)
+    memcpy(summary.minValue, zone.minValue, PREFIX_LENGTH);
+  if (memcmp(zone.maxValue, summary.maxValue, PREFIX_LENGTH) > 0)
+    memcpy(summary.maxValue, zone.maxValue, PREFIX_LENGTH);
+}
+
+void ZoneMap::add(int zone, int key, const char* value, int length)
+{
+  char prefix[PREFIX_LENGTH];
+  makePrefix(value, length, prefix);
+
+  tupleCount++;
+  if (zone < firstDirty) firstDirty = zone;
+  if (zone == zoneCount) {
+    Zone z;
+    z.minKey = z.maxKey = key;
+    memcpy(z.minValue, prefix, PREFIX_LENGTH);
+    memcpy(z.maxValue, prefix, PREFIX_LENGTH);
+    zones.push_back(z);
+    zoneCount++;
+    return;
+  }
+
+  Zone& z = zones[zone];
+  if (key < z.minKey) z.minKey = key;
+  if (key > z.maxKey) z.maxKey = key;
+  if (memcmp(prefix, z.minValue, PREFIX_LENGTH) < 0) memcpy(z.minValue, prefix, PREFIX_LENGTH);
+  if (memcmp(prefix, z.maxValue, PREFIX_LENGTH) > 0) memcpy(z.maxValue, prefix, PREFIX_LENGTH);
+}
+
+void ZoneMap::truncate(int zone, int tuples)
+{
+  if (zone >= zoneCount) return;
+  zoneCount = zone;
+  tupleCount = tuples;
+  if (writable) zones.resize(zone);
+  if (zone < firstDirty) firstDirty = zone;
+}
+
+void ZoneMap::makePrefix(const char* value, int length, char* prefix)
+{
+  int n = strnlen(value, length < PREFIX_LENGTH ? length : PREFIX_LENGTH);
+  memcpy(prefix, value, n);
+  memset(prefix + n, 0, PREFIX_LENGTH - n);
+}
@@ -0,0 +1,138 @@
+/**
+ * ZoneMap keeps a summary of every zone of a table -- a group of
+ * consecutive tuples that are read together -- so that a scan can skip
+ * the zones that no tuple of a query can come from. the summary of a
+ * zone is the smallest and the largest key of its tuples and the first
+ * PREFIX_LENGTH bytes of its smallest and largest value.
+ *
+ * a group of ZONES_PER_PAGE consecutive zones is summarized again (the
+ * smallest and largest key and value prefix of its zones), so that a scan
+ * can skip a group of zones without reading their summaries.
+ *
+ * the zones are stored in a PageFile: page 0 holds # zones and # tuples
+ * that they summarize, the zones follow from page 1 on, ZONES_PER_PAGE to
+ * a page, and the summaries of the groups follow the zones. a zone map
+ * opened for writing is kept in memory; one opened for reading reads the
+ * pages of the zones and groups as they are asked for.
+ */
+
+#ifndef ZONEMAP_H
+#define ZONEMAP_H
+
+#include <string>
+#include <vector>
+#include "Bruinbase.h"
+#include "PageFile.h"
+
+class ZoneMap {
+ public:
+
+  // # bytes of a value that are kept in the summary of a zone
+  static const int PREFIX_LENGTH = 8;
+
+  /**
+   * the summary of a zone. the value prefixes are padded with null
+   * characters, so they compare with memcmp() as the values do with
+   * strcmp(): the prefix of a smaller value is never larger.
+   */
+  typedef struct {
+    int  minKey;
+    int  maxKey;
+    char minValue[PREFIX_LENGTH];
+    char maxValue[PREFIX_LENGTH];
+  } Zone;
+
+  // # zones stored in a page
+  static const int ZONES_PER_PAGE = PageFile::PAGE_SIZE / sizeof(Zone);
+
+  ZoneMap();
+
+  /**
+   * open the zone map in a file. when opened in 'w' mode, the file is
+   * created if it does not exist.
+   * @param filename[IN] the name of the zone map file
+   * @param mode[IN] 'r' for read, 'w' for write
+   * @return error code. 0 if no error
+   */
+  RC open(const std::string& filename, char mode);
+
+  /**
+   * close the zone map, writing the zones that changed since it was
+   * opened. a zone map that is not open is left as it is.
+   * @return error code. 0 if no error
+   */
+  RC close();
+
+  /**
+   * @return # zones in the zone map
+   */
+  int getZoneCount() const { return zoneCount; }
+
+  /**
+   * @return # tuples that the zones summarize
+   */
+  int getTupleCount() const { return tupleCount; }
+
+  /**
+   * read the summary of a zone. like PageFile::read(), it is safe to
+   * call from several threads at once.
+   * @param zone[IN] the zone (less than getZoneCount())
+   * @param summary[OUT] the summary of the zone
+   * @return error code. 0 if no error
+   */
+  RC getZone(int zone, Zone& summary) const;
+
+  /**
+   * read the summary of the group of zones that a zone is in: the zones
+   * [zone/ZONES_PER_PAGE*ZONES_PER_PAGE, +ZONES_PER_PAGE). like getZone(),
+   * it is safe to call from several threads at once.
+   * @param zone[IN] a zone of the group (less than getZoneCount())
+   * @param summary[OUT] the summary of the group
+   * @return error code. 0 if no error
+   */
+  RC getGroup(int zone, Zone& summary) const;
+
+  /**
+   * account for a tuple added to a zone of a zone map opened for
+   * writing. the tuples are added in zone order: the zone is the last
+   * zone or the one after it.
+   * @param zone[IN] the zone of the tuple
+   * @param key[IN] the key of the tuple
+   * @param value[IN] the value of the tuple (not null-terminated)
+   * @param length[IN] the length of the value
+   */
+  void add(int zone, int key, const char* value, int length);
+
+  /**
+   * drop the zones from a zone on, e.g., because tuples were added to
+   * them that they do not summarize.
+   * @param zone[IN] the first zone to drop
+   * @param tuples[IN] # tuples that the zones before it summarize
+   */
+  void truncate(int zone, int tuples);
+
+  /**
+   * compute the prefix of a value, as it is kept in a zone.
+   * @param value[IN] the value (it ends at its first null character)
+   * @param length[IN] the length of the value
+   * @param prefix[OUT] the prefix (PREFIX_LENGTH bytes)
+   */
+  static void makePrefix(const char* value, int length, char* prefix);
+
+ private:
+  // widen a summary to cover another
+  static void merge(Zone& summary, const Zone& zone);
+
+  // # pages of the zones of the zone map
+  int getZonePageCount() const { return (zoneCount + ZONES_PER_PAGE - 1) / ZONES_PER_PAGE; }
+
+  PageFile          pf;         // the file of the zone map
+  std::vector<Zone> zones;      // 'w' mode: the summaries of the zones
+  int               zoneCount;  // # zones
+  int               tupleCount; // # tuples that the zones summarize
+  int               firstDirty; // 'w' mode: the first zone that is not written yet
+  bool              writable;   // true if opened in 'w' mode
+  bool              opened;     // true if the file is open
+};
+
+#endif // ZONEMAP_H
@@ -0,0 +1,43 @@
+#!/bin/sh
+# A load with more index entries than the load buffers in memory builds
+# its new index bottom-up from sorted runs: the index finds every tuple,
+# its leaves are full, and the file of the runs is removed.
+# usage: sh tests/bulk_load.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+# two runs of the 1M entries of the load buffer and a part of a third
+ROWS=2200000
+awk -v n=$ROWS 'BEGIN { srand(3); for (i = 0; i < n; i++) printf "%d,v%d\n", int(rand() * 1000000), i % 10 }' > big.del
+RANGE=$(awk -F, '$1 > 500000 && $1 < 501000 { n++ } END { print n }' big.del)
+SEVEN=$(grep -c '^777777,' big.del)
+
+RESULTS=$("$BRUINBASE" 2>/dev/null <<SQL | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p'
+load big from 'big.del' with index
+select count(*) from big where key >= 0
+select count(*) from big where key > 500000 and key < 501000
+select count(*) from big where key = 777777
+SQL
+)
+
+EXPECTED="$ROWS $RANGE $SEVEN"
+if [ "$(echo $RESULTS)" != "$EXPECTED" ]; then
+  echo "bulk_load: expected $EXPECTED, got $(echo $RESULTS)"
+  exit 1
+fi
+
+# a plain leaf holds 83 entries: the leaves of an index that is built by
+# insertions are about two thirds full
+PAGES=$(($(wc -c < big.idx) / 1024))
+if [ $PAGES -gt $((ROWS / 83 * 11 / 10)) ]; then
+  echo "bulk_load: the index has $PAGES pages, it was not built bottom-up"
+  exit 1
+fi
+if ls -a | grep -q '\.tmp$'; then
+  echo "bulk_load: the file of the index runs was left behind"
+  exit 1
+fi
+echo "bulk_load: ok"
@@ -0,0 +1,57 @@
+#!/bin/sh
+# A columnar table answers queries as a plain table does, also after it
+# is reopened and appended to, and a scan that needs only the keys reads
+# only the key pages.
+# usage: sh tests/columnar_storage.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { srand(4); for (i = 0; i < 30000; i++) printf "%d,a value of %d\n", int(rand() * 10000), i % 29 }' > rows.del
+
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load p from 'rows.del' with index
+set storage columnar
+load c from 'rows.del' with index
+SQL
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load p from 'rows.del' with index
+set storage columnar
+load c from 'rows.del' with index
+SQL
+
+# run the queries on a table and print their results
+queries() {
+  "$BRUINBASE" 2>/dev/null <<SQL
+select * from $1
+select count(*) from $1 where key > 5000
+select count(*) from $1 where value = 'a value of 7'
+select sum(key) from $1 where value > 'a value of 20'
+select min(value) from $1 where key < 100
+select max(key) from $1
+select value, count(*) from $1 group by value
+select * from $1 where key > 9990 order by value desc limit 5
+SQL
+}
+if [ "$(queries p | cksum)" != "$(queries c | cksum)" ]; then
+  echo "columnar_storage: the columnar table returns other results than the plain one"
+  exit 1
+fi
+if [ ! -f c.val ]; then
+  echo "columnar_storage: the table is not columnar"
+  exit 1
+fi
+
+# print the # pages that a scan of the keys of a table reads
+keyPages() {
+  echo "select count(*) from $1 where key <> 77" | "$BRUINBASE" 2>&1 | sed -n 's/.* Read \([0-9]*\) pages/\1/p'
+}
+P=$(keyPages p)
+C=$(keyPages c)
+if [ $((C * 3)) -gt "$P" ]; then
+  echo "columnar_storage: a key scan reads $C pages of the columnar table and $P of the plain one"
+  exit 1
+fi
+echo "columnar_storage: ok"
@@ -0,0 +1,59 @@
+#!/bin/sh
+# A compressed table returns the same tuples as a plain one, also after
+# it is reopened and appended to, and a load that is killed before it
+# closes the table leaves the tuples of the earlier loads readable.
+# usage: sh tests/compressed_storage.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { for (i = 0; i < 20000; i++) printf "%d,value %d\n", i % 5000, i % 97 }' > rows.del
+
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load plain from 'rows.del'
+load plain from 'rows.del'
+set storage compressed
+load packed from 'rows.del'
+SQL
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+set storage compressed
+load packed from 'rows.del'
+SQL
+
+PLAIN=$(echo "select * from plain" | "$BRUINBASE" 2>/dev/null | cksum)
+PACKED=$(echo "select * from packed" | "$BRUINBASE" 2>/dev/null | cksum)
+if [ "$PLAIN" != "$PACKED" ]; then
+  echo "compressed_storage: the compressed table differs from the plain one"
+  exit 1
+fi
+if [ "$(wc -c < packed.tbl)" -ge "$(wc -c < plain.tbl)" ]; then
+  echo "compressed_storage: the table is not compressed"
+  exit 1
+fi
+
+# kill a load from the command input once it has written the blocks of
+# its first rows. the command input stays open, so that the load does
+# not end by itself
+SIZE=$(wc -c < packed.tbl)
+mkfifo input
+"$BRUINBASE" < input >/dev/null 2>&1 &
+PID=$!
+exec 3> input
+echo "load packed from stdin" >&3
+awk 'BEGIN { for (i = 0; i < 200000; i++) printf "%d,new %d\n", i, i }' >&3
+for i in $(seq 1 100); do
+  [ "$(wc -c < packed.tbl)" -gt $((SIZE + 100000)) ] && break
+  sleep 0.1
+done
+kill -9 $PID
+wait $PID 2>/dev/null
+exec 3>&-
+
+COUNT=$(echo "select count(*) from packed" | "$BRUINBASE" 2>&1 | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p')
+if [ "$COUNT" != 40000 ]; then
+  echo "compressed_storage: expected 40000 tuples after the killed load, got '$COUNT'"
+  exit 1
+fi
+echo "compressed_storage: ok"
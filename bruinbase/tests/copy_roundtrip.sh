@@ -0,0 +1,45 @@
+#!/bin/sh
+# COPY writes a table to the binary batch format, plain or through a
+# compressor, and loading the file back gives the same tuples, also
+# into compressed and columnar tables, and out of a columnar one.
+# usage: sh tests/copy_roundtrip.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk -v q="'" 'BEGIN { for (i = 0; i < 40000; i++) printf "%d,%svalue, %d%s\n", i * 3 - 20000, q, i % 17, q }' > rows.del
+printf "7,\n8,x\n" >> rows.del
+
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del' with index
+copy t to 't.bin'
+copy t to 't.bin.gz'
+load b from 't.bin' with index
+load g from 't.bin.gz'
+set storage compressed
+load c from 't.bin'
+set storage columnar
+load k from 't.bin'
+copy k to 'k.bin'
+set storage plain
+load kb from 'k.bin'
+SQL
+
+T=$(echo "select * from t" | "$BRUINBASE" 2>/dev/null | cksum)
+for table in b g c k kb; do
+  if [ "$(echo "select * from $table" | "$BRUINBASE" 2>/dev/null | cksum)" != "$T" ]; then
+    echo "copy_roundtrip: table $table differs from the table it was copied from"
+    exit 1
+  fi
+done
+if ! cmp -s t.bin k.bin; then
+  echo "copy_roundtrip: a columnar table is written to another file than a plain one"
+  exit 1
+fi
+if [ "$(gzip -dc t.bin.gz | cksum)" != "$(cksum < t.bin)" ]; then
+  echo "copy_roundtrip: the compressed copy differs from the plain one"
+  exit 1
+fi
+echo "copy_roundtrip: ok"
@@ -0,0 +1,52 @@
+#!/bin/sh
+# EXPLAIN picks the index for narrow key ranges and a full scan for wide
+# ones, reads nothing for conditions that cannot hold, and does not use
+# statistics that are out of date.
+# usage: sh tests/explain.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { for (i = 0; i < 50000; i++) printf "%d,v%d\n", i, i % 13 }' > rows.del
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del' with index
+SQL
+
+PLANS=$("$BRUINBASE" 2>/dev/null <<SQL | sed -n 's/^\(Bruinbase> \)*  plan: //p'
+explain select count(*) from t
+explain select * from t where key = 100
+explain select * from t where key > 100 and key < 200
+explain select * from t where key > 100
+explain select * from t where value = 'v3'
+explain select * from t where key > 100 and key < 50
+explain select * from t where key < 1000 order by key desc limit 3
+SQL
+)
+EXPECTED="tuple count from the statistics of t
+index scan of t.idx, fetching tuples from t.tbl
+index scan of t.idx, fetching tuples from t.tbl
+full scan of t.tbl
+full scan of t.tbl
+no tuple can satisfy the conditions, nothing is read
+index scan of t.idx, fetching tuples from t.tbl"
+if [ "$PLANS" != "$EXPECTED" ]; then
+  echo "explain: unexpected plans:"
+  echo "$PLANS"
+  exit 1
+fi
+
+# statistics that do not count the tuples of the table any more are not
+# used: the plan is picked by rules
+cp t.sts old.sts
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del' with index
+SQL
+mv old.sts t.sts
+STATS=$(echo "explain select * from t where key > 100" | "$BRUINBASE" 2>/dev/null | grep -c "no statistics for table t")
+if [ "$STATS" != 1 ]; then
+  echo "explain: the plan used statistics of an older version of the table"
+  exit 1
+fi
+echo "explain: ok"
@@ -0,0 +1,34 @@
+#!/bin/sh
+# An index that is built by insertions over many duplicate keys returns
+# every copy of a key, and a scan of it counts the same tuples with one
+# and with four threads.
+# usage: sh tests/index_duplicates.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+# 30000 tuples over 300 keys, loaded twice: the second load inserts its
+# entries into the index one by one
+awk 'BEGIN { srand(1); for (i = 0; i < 30000; i++) printf "%d,v%d\n", int(rand() * 300), i }' > dup.del
+COPIES=$(grep -c '^7,' dup.del)
+
+RESULTS=$("$BRUINBASE" 2>/dev/null <<SQL | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p'
+load dup from 'dup.del' with index
+load dup from 'dup.del' with index
+set threads 1
+select count(*) from dup where key >= 0
+select count(*) from dup where key = 7
+set threads 4
+select count(*) from dup where key >= 0
+select count(*) from dup where key = 7
+SQL
+)
+
+EXPECTED="60000 $((COPIES * 2)) 60000 $((COPIES * 2))"
+if [ "$(echo $RESULTS)" != "$EXPECTED" ]; then
+  echo "index_duplicates: expected $EXPECTED, got $(echo $RESULTS)"
+  exit 1
+fi
+echo "index_duplicates: ok"
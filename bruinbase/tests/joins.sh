@@ -0,0 +1,60 @@
+#!/bin/sh
+# A merge join, an index nested-loop join and a hash join count the
+# tuples that a join of the load files counts, a join with two join
+# conditions is not run, and a join that cannot read a table reports an
+# error instead of a short count.
+# usage: sh tests/joins.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { for (i = 0; i < 3000; i++) printf "%d,v%d\n", i, i % 7 }' > a.del
+awk 'BEGIN { for (i = 0; i < 6000; i++) printf "%d,v%d\n", (i * 7) % 3000, i % 5 }' > b.del
+
+# the # pairs of lines of a.del and b.del with the same key, with the
+# same key above 2990, and with the same value
+KEYS=$(awk -F, 'NR == FNR { a[$1]++; next } { n += a[$1] } END { print n }' a.del b.del)
+HIGH=$(awk -F, 'NR == FNR { a[$1]++; next } $1 > 2990 { n += a[$1] } END { print n }' a.del b.del)
+VALUES=$(awk -F, 'NR == FNR { a[$2]++; next } { n += a[$2] } END { print n }' a.del b.del)
+
+OUTPUT=$("$BRUINBASE" 2>/dev/null <<SQL
+load a from 'a.del' with index
+load b from 'b.del' with index
+load h from 'b.del'
+explain select count(*) from a, b where a.key = b.key
+select count(*) from a, b where a.key = b.key
+explain select count(*) from a, h where h.key = a.key and h.key > 2990
+select count(*) from a, h where h.key = a.key and h.key > 2990
+explain select count(*) from a, h where a.value = h.value
+select count(*) from a, h where a.value = h.value
+select count(*) from a, h where a.key = h.key and a.value = h.value
+SQL
+)
+PLANS=$(echo "$OUTPUT" | sed -n 's/^\(Bruinbase> \)*  plan: \([a-z]*\) .*/\2/p')
+COUNTS=$(echo "$OUTPUT" | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p')
+
+if [ "$(echo $PLANS)" != "merge index hash" ]; then
+  echo "joins: unexpected plans: $(echo $PLANS)"
+  exit 1
+fi
+if [ "$(echo $COUNTS)" != "$KEYS $HIGH $VALUES" ]; then
+  echo "joins: expected $KEYS $HIGH $VALUES, got $(echo $COUNTS)"
+  exit 1
+fi
+
+# cut off the second half of the tuples of a, which the index entries
+# of the keys above 2990 point to
+truncate -s $(($(wc -c < a.tbl) / 2048 * 1024)) a.tbl
+OUTPUT=$("$BRUINBASE" 2>&1 <<SQL
+select count(*) from a, h where h.key = a.key and h.key > 2990
+SQL
+)
+ERRORS=$(echo "$OUTPUT" | grep Error)
+COUNTS=$(echo "$OUTPUT" | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p')
+if [ -z "$ERRORS" ] || [ -n "$COUNTS" ]; then
+  echo "joins: a join over a cut-off table returned '$COUNTS' without an error"
+  exit 1
+fi
+echo "joins: ok"
@@ -0,0 +1,25 @@
+#!/bin/sh
+# A load file whose last line ends with a line break loads without an
+# error, and the load saves the statistics of the new table.
+# usage: sh tests/load_newline.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+printf "1,one\n2,'two'\n3,\"three\"\n" > rows.del
+ERRORS=$("$BRUINBASE" 2>&1 >/dev/null <<SQL
+load t from 'rows.del' with index
+SQL
+)
+
+if [ -n "$ERRORS" ]; then
+  echo "load_newline: $ERRORS"
+  exit 1
+fi
+if [ ! -f t.sts ]; then
+  echo "load_newline: the load saved no statistics"
+  exit 1
+fi
+echo "load_newline: ok"
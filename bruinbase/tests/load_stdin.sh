@@ -0,0 +1,42 @@
+#!/bin/sh
+# LOAD FROM STDIN reads the rows up to the line with "\." and leaves the
+# commands after it to the command input, also after a bad row, and a
+# compressed load file is read through its decompressor.
+# usage: sh tests/load_stdin.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { for (i = 0; i < 30000; i++) printf "%d,row %d\n", i, i % 11 }' > rows.del
+gzip -c rows.del > rows.del.gz
+
+OUTPUT=$( (echo "load s from stdin with index"
+  cat rows.del
+  echo '\.'
+  echo "select count(*) from s where key >= 0"
+  echo "load s from stdin with index"
+  echo "1,one"
+  echo "bogus"
+  echo "2,two"
+  echo '\.'
+  echo "select count(*) from s"
+  echo "load z from 'rows.del.gz'"
+  echo "load p from 'rows.del'") | "$BRUINBASE" 2>&1)
+COUNTS=$(echo "$OUTPUT" | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p')
+ERRORS=$(echo "$OUTPUT" | grep -c Error)
+
+if [ "$(echo $COUNTS)" != "30000 30001" ] || [ "$ERRORS" != 1 ]; then
+  echo "load_stdin: expected the counts 30000 30001 and one error, got:"
+  echo "$OUTPUT"
+  exit 1
+fi
+
+Z=$(echo "select * from z" | "$BRUINBASE" 2>/dev/null | cksum)
+P=$(echo "select * from p" | "$BRUINBASE" 2>/dev/null | cksum)
+if [ "$Z" != "$P" ]; then
+  echo "load_stdin: the table loaded from the compressed file differs"
+  exit 1
+fi
+echo "load_stdin: ok"
@@ -0,0 +1,43 @@
+#!/bin/sh
+# The parallel table and index scans return what a scan on one thread
+# returns, also for the queries whose scan stops early at a LIMIT, and
+# the counts match the load file.
+# usage: sh tests/parallel_scans.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { srand(2); for (i = 0; i < 100000; i++) printf "%d,v%d\n", int(rand() * 50000), i % 13 }' > rows.del
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del' with index
+SQL
+
+cat > queries.sql <<SQL
+select count(*) from t where value = 'v3'
+select count(*) from t where key > 10000 and key < 30000
+select sum(key) from t where value = 'v5'
+select min(value) from t where key > 49000
+select max(key) from t where value = 'v7'
+select avg(key) from t where key < 25000
+select * from t where value = 'v3' limit 5
+select * from t where key > 20000 and value = 'v9' limit 5
+select value, count(*) from t where key > 1000 group by value
+select * from t where key < 40 order by value desc limit 8
+SQL
+
+ONE=$( (echo "set threads 1"; cat queries.sql) | "$BRUINBASE" 2>/dev/null)
+FOUR=$( (echo "set threads 4"; cat queries.sql) | "$BRUINBASE" 2>/dev/null)
+if [ "$ONE" != "$FOUR" ]; then
+  echo "parallel_scans: four threads return other results than one thread"
+  exit 1
+fi
+
+EXPECTED="$(awk -F, '$2 == "v3" { n++ } END { print n }' rows.del) $(awk -F, '$1 > 10000 && $1 < 30000 { n++ } END { print n }' rows.del)"
+COUNTS=$(echo "$FOUR" | sed -n 's/^\(Bruinbase> \)*\([0-9][0-9]*\)$/\2/p' | head -2)
+if [ "$(echo $COUNTS)" != "$EXPECTED" ]; then
+  echo "parallel_scans: expected $EXPECTED, got $(echo $COUNTS)"
+  exit 1
+fi
+echo "parallel_scans: ok"
@@ -0,0 +1,59 @@
+#!/bin/sh
+# LOAD keeps the statistics of a table up to date and ANALYZE rebuilds
+# them: the tuple count and the key range are exact, the distinct counts
+# are close to the real ones and never above the tuple count.
+# usage: sh tests/statistics.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+# print the tuple count, the key range and the distinct counts of a table
+stats() {
+  echo "explain select * from $1 where key > 0" | "$BRUINBASE" 2>/dev/null |
+    sed -n 's/.*statistics: \([0-9]*\) tuples in [0-9]* pages, keys in \[\(-*[0-9]*\), \(-*[0-9]*\)\], ~\([0-9]*\) distinct keys, ~\([0-9]*\) distinct values.*/\1 \2 \3 \4 \5/p'
+}
+
+# check that an estimate is within 5% of the real count
+close() {
+  [ $(($1 * 100)) -ge $(($2 * 95)) ] && [ $(($1 * 100)) -le $(($2 * 105)) ]
+}
+
+awk 'BEGIN { for (i = 0; i < 60000; i++) printf "%d,v%d\n", (i * 7) % 20000 - 5000, i % 100 }' > rows.del
+printf "1,a\n2,a\n2,b\n" > few.del
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del'
+load few from 'few.del'
+SQL
+
+set -- $(stats t)
+if [ "$1 $2 $3" != "60000 -5000 14999" ] || ! close $4 20000 || ! close $5 100; then
+  echo "statistics: unexpected statistics of t: $*"
+  exit 1
+fi
+set -- $(stats few)
+if [ "$1 $2 $3 $4 $5" != "3 1 2 2 2" ]; then
+  echo "statistics: unexpected statistics of few: $*"
+  exit 1
+fi
+
+# a second load adds to the statistics, and ANALYZE rebuilds them
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del'
+SQL
+set -- $(stats t)
+if [ "$1" != 120000 ] || ! close $4 20000; then
+  echo "statistics: unexpected statistics of t after a second load: $*"
+  exit 1
+fi
+rm t.sts
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+analyze t
+SQL
+set -- $(stats t)
+if [ "$1 $2 $3" != "120000 -5000 14999" ] || ! close $4 20000 || ! close $5 100; then
+  echo "statistics: unexpected statistics of t after ANALYZE: $*"
+  exit 1
+fi
+echo "statistics: ok"
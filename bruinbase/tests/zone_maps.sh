@@ -0,0 +1,54 @@
+#!/bin/sh
+# The zone map of a table whose keys and values follow the load order
+# skips the pages that cannot hold a match of a key or a value
+# condition, and the results are those of the same table without a
+# zone map.
+# usage: sh tests/zone_maps.sh ./bruinbase
+
+BRUINBASE=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+cd "$DIR" || exit 1
+
+awk 'BEGIN { for (i = 0; i < 50000; i++) printf "%d,v%05d\n", i, int(i / 10) }' > rows.del
+"$BRUINBASE" >/dev/null 2>&1 <<SQL
+load t from 'rows.del'
+set storage columnar
+load c from 'rows.del'
+SQL
+# a copy of the table without its zone map
+cp t.tbl n.tbl
+
+# run the queries on a table and print their results
+queries() {
+  "$BRUINBASE" 2>/dev/null <<SQL
+select count(*) from $1 where key > 49000
+select * from $1 where key >= 20000 and key < 20020
+select count(*) from $1 where value > 'v04990'
+select * from $1 where value = 'v02500'
+select count(*) from $1 where key < 100 or key > 49950
+SQL
+}
+N=$(queries n | cksum)
+for table in t c; do
+  if [ "$(queries $table | cksum)" != "$N" ]; then
+    echo "zone_maps: table $table returns other results than a table without a zone map"
+    exit 1
+  fi
+done
+
+# print the # zones that the scans of a key and of a value condition read
+zones() {
+  "$BRUINBASE" 2>/dev/null <<SQL | sed -n 's/^\(Bruinbase> \)*  zone map: \([0-9]*\) of [0-9]* zones are read/\2/p'
+explain select * from $1 where key > 49000
+explain select * from $1 where value > 'v04990'
+SQL
+}
+for table in t c; do
+  set -- $(zones $table)
+  if [ $# != 2 ] || [ "$1" -gt 150 ] || [ "$2" -gt 20 ]; then
+    echo "zone_maps: the scans of table $table read $* zones"
+    exit 1
+  fi
+done
+echo "zone_maps: ok"